@@ -0,0 +1,202 @@
+// Physics micro-benchmark: collision queries over 1k-100k colliders.
+// Built only with -DENGINE_BUILD_BENCHMARKS=ON; not part of the engine or the game.
+
+#include "Core/JobSystem.h"
+#include "Physics/Physics.h"
+#include "Physics/Collider.h"
+#include "Physics/BoundsSoA.h"
+#include "Entities/Entity.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <memory>
+#include <random>
+#include <thread>
+#include <vector>
+
+using Clock = std::chrono::steady_clock;
+
+static double MillisecondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Colliders spread so the average number of neighbours stays the same at every count
+static std::vector<std::unique_ptr<Entity>> CreateScene(size_t count, std::mt19937& rng)
+{
+    float worldSize = std::sqrt((float)count) * 40.0f;
+    std::uniform_real_distribution<float> position(-worldSize * 0.5f, worldSize * 0.5f);
+    std::uniform_real_distribution<float> size(4.0f, 32.0f);
+
+    std::vector<std::unique_ptr<Entity>> entities;
+    entities.reserve(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        auto entity = std::make_unique<Entity>();
+        entity->SetPosition(glm::vec2(position(rng), position(rng)));
+
+        if (i % 4 == 0)
+            entity->SetCollider(std::make_unique<CircleCollider>(entity.get(), size(rng) * 0.5f));
+        else
+            entity->SetCollider(std::make_unique<BoxCollider>(entity.get(), glm::vec2(size(rng), size(rng))));
+
+        entities.push_back(std::move(entity));
+    }
+
+    return entities;
+}
+
+// The old inner loop: every pair through Collider::CheckCollision
+static size_t NaivePairs(const std::vector<std::unique_ptr<Entity>>& entities)
+{
+    size_t hits = 0;
+    for (const auto& a : entities)
+    {
+        for (const auto& b : entities)
+        {
+            if (a != b && a->GetCollider()->CheckCollision(b->GetCollider()))
+                hits++;
+        }
+    }
+    return hits;
+}
+
+static size_t PhysicsPairs(const std::vector<std::unique_ptr<Entity>>& entities)
+{
+    Physics::BeginFrame();
+
+    size_t hits = 0;
+    for (const auto& entity : entities)
+        hits += Physics::GetCollisions(entity->GetCollider()).size();
+    return hits;
+}
+
+static void BenchmarkKernel(size_t count, std::mt19937& rng)
+{
+    std::uniform_real_distribution<float> position(-1000.0f, 1000.0f);
+
+    std::vector<AABB> boxes(count);
+    BoundsSoA bounds;
+    bounds.Resize(count);
+    for (uint32_t i = 0; i < (uint32_t)count; i++)
+    {
+        boxes[i] = AABB::FromCenter(glm::vec2(position(rng), position(rng)), glm::vec2(16.0f));
+        bounds.Set(i, boxes[i], 0);
+    }
+
+    static constexpr int QUERIES = 200;
+    AABB query = AABB::FromCenter(glm::vec2(0.0f), glm::vec2(64.0f));
+    std::vector<uint32_t> out;
+    out.reserve(count);
+
+    Clock::time_point start = Clock::now();
+    size_t scalarHits = 0;
+    for (int q = 0; q < QUERIES; q++)
+    {
+        out.clear();
+        for (uint32_t i = 0; i < (uint32_t)count; i++)
+        {
+            if (boxes[i].Overlaps(query))
+                out.push_back(i);
+        }
+        scalarHits += out.size();
+    }
+    double scalarMs = MillisecondsSince(start) / QUERIES;
+
+    start = Clock::now();
+    size_t simdHits = 0;
+    for (int q = 0; q < QUERIES; q++)
+    {
+        out.clear();
+        OverlapRange(bounds, query, 0, (uint32_t)count, out);
+        simdHits += out.size();
+    }
+    double simdMs = MillisecondsSince(start) / QUERIES;
+
+    std::printf("  kernel scan     %8.4f ms AoS   %8.4f ms SoA (%s)%s\n",
+                scalarMs, simdMs, GetOverlapKernelName(), scalarHits == simdHits ? "" : "  MISMATCH");
+}
+
+int main()
+{
+    static const size_t COUNTS[] = { 1000, 10000, 100000 };
+    static const BroadphaseType BROADPHASES[] = {
+        BroadphaseType::BruteForce, BroadphaseType::SpatialHash,
+        BroadphaseType::SweepAndPrune, BroadphaseType::AABBTree
+    };
+    static const char* BROADPHASE_NAMES[] = { "brute force", "spatial hash", "sweep+prune", "aabb tree" };
+
+    std::mt19937 rng(1234);
+
+    for (size_t count : COUNTS)
+    {
+        std::printf("%zu colliders\n", count);
+        BenchmarkKernel(count, rng);
+
+        Physics::Init();
+        auto entities = CreateScene(count, rng);
+
+        // Quadratic, so only where it finishes in reasonable time
+        size_t reference = 0;
+        if (count <= 10000)
+        {
+            Clock::time_point start = Clock::now();
+            reference = NaivePairs(entities);
+            std::printf("  naive pairs     %10.3f ms  (%zu contacts)\n", MillisecondsSince(start), reference);
+        }
+
+        for (int b = 0; b < 4; b++)
+        {
+            // Brute force through Physics is quadratic too
+            if (BROADPHASES[b] == BroadphaseType::BruteForce && count > 10000)
+                continue;
+
+            PhysicsSettings settings;
+            settings.Broadphase = BROADPHASES[b];
+            settings.CellSize = 32.0f;
+            Physics::SetSettings(settings);
+
+            PhysicsPairs(entities);  // Warm up (first build creates persistent proxies)
+
+            static constexpr int FRAMES = 5;
+            size_t hits = 0;
+            Clock::time_point start = Clock::now();
+            for (int frame = 0; frame < FRAMES; frame++)
+                hits = PhysicsPairs(entities);
+            double ms = MillisecondsSince(start) / FRAMES;
+
+            bool mismatch = reference != 0 && hits != reference;
+            std::printf("  %-14s  %10.3f ms  (%zu contacts)%s\n", BROADPHASE_NAMES[b], ms, hits, mismatch ? "  MISMATCH" : "");
+        }
+
+        // Whole per-tick contact pass, narrow phase on one thread and then on all of them
+        PhysicsSettings settings;
+        settings.Broadphase = BroadphaseType::SweepAndPrune;
+        Physics::SetSettings(settings);
+
+        static constexpr float FIXED_DELTA_TIME = 1.0f / 60.0f;
+        uint32_t hardwareThreads = std::max(1u, std::thread::hardware_concurrency());
+        for (uint32_t threads : { 1u, hardwareThreads })
+        {
+            JobSystem::Init(threads - 1);
+            Physics::Step(FIXED_DELTA_TIME);
+
+            static constexpr int TICKS = 5;
+            Clock::time_point start = Clock::now();
+            for (int tick = 0; tick < TICKS; tick++)
+                Physics::Step(FIXED_DELTA_TIME);
+            std::printf("  step, %2u thread%s %8.3f ms\n", threads, threads == 1 ? " " : "s", MillisecondsSince(start) / TICKS);
+
+            if (hardwareThreads == 1) break;
+        }
+        JobSystem::Shutdown();
+
+        entities.clear();
+        Physics::Shutdown();
+    }
+
+    return 0;
+}
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 class Window;
 class Camera;
@@ -19,14 +21,33 @@ public:
     virtual void OnRender() = 0;
     virtual void OnInput(float deltaTime) {}
 
+    // Called once per active camera, inside that camera's scene pass.
+    // The default renders the whole game for every camera.
+    virtual void OnRenderCamera(Camera& /*camera*/) { OnRender(); }
+
     // Engine access
     void SetWindow(Window* window) { m_Window = window; }
-    void SetCamera(Camera* camera) { m_Camera = camera; }
+    void SetCamera(Camera* camera)
+    {
+        RemoveCamera(m_Camera);
+        m_Camera = camera;
+        if (camera) m_Cameras.insert(m_Cameras.begin(), camera);
+    }
     
     Window* GetWindow() { return m_Window; }
     Camera* GetCamera() { return m_Camera; }
 
+    // Extra cameras (UI, minimap, split-screen) rendered after the main camera,
+    // in the order they were added. The game owns them.
+    void AddCamera(Camera* camera) { if (camera) m_Cameras.push_back(camera); }
+    void RemoveCamera(Camera* camera)
+    {
+        m_Cameras.erase(std::remove(m_Cameras.begin(), m_Cameras.end(), camera), m_Cameras.end());
+    }
+    const std::vector<Camera*>& GetCameras() const { return m_Cameras; }
+
 protected:
     Window* m_Window = nullptr;
     Camera* m_Camera = nullptr;
+    std::vector<Camera*> m_Cameras;  // Main camera first
 };
\ No newline at end of file
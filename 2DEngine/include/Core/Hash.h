@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// FNV-1a hashing used for cache keys (text meshes, layouts, font files)
+static constexpr uint64_t HASH_SEED = 14695981039346656037ull;
+
+inline uint64_t HashBytes(const void* data, size_t size, uint64_t seed = HASH_SEED)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    uint64_t hash = seed;
+    for (size_t i = 0; i < size; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// Mix a trivially-copyable value into an existing hash
+template<typename T>
+inline uint64_t HashCombine(uint64_t seed, const T& value)
+{
+    return HashBytes(&value, sizeof(T), seed);
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+// Fixed pool of worker threads for data-parallel loops. Workers are started once
+// (Init) and sleep between batches, so a ParallelFor costs a wake-up, not a thread.
+class JobSystem
+{
+public:
+    // 0 = one worker per hardware thread, minus the calling thread
+    static void Init(uint32_t workerThreads = 0);
+    static void Shutdown();
+
+    // Threads that can run a ParallelFor job at once (workers + the calling thread)
+    static uint32_t GetThreadCount() { return s_ThreadCount; }
+
+    // job(begin, end, thread) over chunks of [0, count), at least minChunk items each.
+    // 'thread' is in [0, GetThreadCount()) and unique among concurrently running
+    // chunks, so it can index per-thread buffers. The calling thread takes chunks
+    // too and returns once all are done. Runs inline when the pool isn't running,
+    // the range is too small to split, or when called from inside a job (a nested
+    // call gets the enclosing job's 'thread').
+    template<typename Function>
+    static void ParallelFor(size_t count, size_t minChunk, Function&& job)
+    {
+        // Passed by pointer rather than as a std::function, so capturing lambdas
+        // never allocate
+        using FunctionType = std::remove_reference_t<Function>;
+        Dispatch(count, minChunk,
+            [](void* context, size_t begin, size_t end, uint32_t thread)
+            {
+                (*static_cast<FunctionType*>(context))(begin, end, thread);
+            },
+            const_cast<void*>(static_cast<const void*>(&job)));
+    }
+
+private:
+    using JobFunction = void (*)(void* context, size_t begin, size_t end, uint32_t thread);
+
+    static void Dispatch(size_t count, size_t minChunk, JobFunction function, void* context);
+    static void WorkerMain(uint32_t thread, uint64_t lastBatch);
+    static void RunChunks(uint32_t thread);
+
+    static uint32_t s_ThreadCount;
+};
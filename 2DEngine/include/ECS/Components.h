@@ -0,0 +1,40 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+class Entity;
+class Texture;
+
+// Built-in components used by the engine systems (ECS/Systems.h). Games can add their
+// own the same way: any plain-data struct works with World.
+
+struct Transform
+{
+    glm::vec2 Position = glm::vec2(0.0f);
+    glm::vec2 Scale = glm::vec2(1.0f);
+    float Rotation = 0.0f;  // Radians
+};
+
+// Units per second, applied to Transform by TransformSystem
+struct Velocity
+{
+    glm::vec2 Value = glm::vec2(0.0f);
+};
+
+// Drawn centered on Transform::Position, Size scaled by Transform::Scale
+struct Sprite
+{
+    Texture* Image = nullptr;                                  // Null draws a solid quad
+    glm::vec4 TexCoords = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);   // (minU, minV, maxU, maxV)
+    glm::vec4 Color = glm::vec4(1.0f);
+    glm::vec2 Size = glm::vec2(1.0f);
+    bool Visible = true;
+};
+
+// Ties an ECS entity to an Entity object (an ECSEntity, or any existing Entity) that
+// owns its collider. ColliderSyncSystem copies the Transform onto it so Physics sees
+// the ECS position. The World doesn't own the object.
+struct EntityLink
+{
+    Entity* Object = nullptr;
+};
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "ECS/Components.h"
+#include "ECS/World.h"
+#include "Entities/Entity.h"
+
+// Adapter that gives an ECS entity an Entity face, so code built around Entity keeps
+// working: it can own a collider (Physics needs an Entity owner), receive collision
+// callbacks by overriding them, and sit in the game's existing entity lists.
+//
+// The ECS entity is created with a Transform and an EntityLink back to this object and
+// is destroyed with it, so the World must outlive it. The Transform is the real
+// position: move the entity through GetTransform() and run ColliderSyncSystem to
+// copy it back here. Entity::SetPosition on this object is overwritten by the next sync.
+class ECSEntity : public Entity
+{
+public:
+    ECSEntity(World& world, const std::string& name = "ECSEntity");
+    ~ECSEntity() override;
+
+    // Draws the Sprite component if there is one. Skip this when SpriteRenderSystem
+    // already draws the World, or the sprite is drawn twice.
+    void Render() override;
+
+    World& GetWorld() const { return m_World; }
+    EntityID GetID() const { return m_ID; }
+
+    Transform& GetTransform() { return *m_World.Get<Transform>(m_ID); }
+
+    // Component access on the ECS entity
+    template<typename T> T* Get() { return m_World.Get<T>(m_ID); }
+    template<typename T> T& Add(const T& component = T()) { return m_World.Add<T>(m_ID, component); }
+    template<typename T> void Remove() { m_World.Remove<T>(m_ID); }
+
+private:
+    World& m_World;
+    EntityID m_ID;
+};
@@ -0,0 +1,33 @@
+#pragma once
+
+class World;
+struct Transform;
+struct Sprite;
+
+// Engine systems over the built-in components. Each is one linear pass over the
+// matching chunks; games call them from their own update and render functions.
+
+// Transform += Velocity * deltaTime
+class TransformSystem
+{
+public:
+    static void Update(World& world, float deltaTime);
+};
+
+// Draws every visible Sprite at its Transform (inside a Renderer scene)
+class SpriteRenderSystem
+{
+public:
+    static void Render(World& world);
+
+    // One sprite, for code that draws outside the batch pass (ECSEntity::Render)
+    static void Draw(const Transform& transform, const Sprite& sprite);
+};
+
+// Copies Transform onto EntityLink objects, so their colliders follow the ECS position.
+// Run it after moving entities and before Physics queries or Physics::Step.
+class ColliderSyncSystem
+{
+public:
+    static void Update(World& world);
+};
@@ -0,0 +1,262 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+// Refers to an entity in a World. Once the entity is destroyed its slot's generation
+// moves on and the ID no longer resolves (same scheme as ColliderHandle).
+struct EntityID
+{
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFF;
+
+    uint32_t Index = INVALID_INDEX;
+    uint32_t Generation = 0;
+
+    bool IsNull() const { return Index == INVALID_INDEX; }
+    bool operator==(const EntityID& other) const { return Index == other.Index && Generation == other.Generation; }
+    bool operator!=(const EntityID& other) const { return !(*this == other); }
+};
+
+// One bit per component type
+using ComponentMask = uint64_t;
+
+// Archetype-based entity storage. Entities with the same set of components share an
+// archetype, whose chunks hold each component in its own contiguous array, so a query
+// walks a few flat arrays instead of chasing one heap object per entity.
+//
+// Components are plain data: trivially copyable and destructible structs (see
+// ECS/Components.h). Creating, destroying or changing the components of an entity
+// moves rows around, so don't do it from inside Each / EachChunk; use DeferDestroy
+// and FlushDeferred for entities that die during a query.
+class World
+{
+public:
+    static constexpr uint32_t MAX_COMPONENT_TYPES = 64;
+    static constexpr size_t CHUNK_BYTES = 16 * 1024;
+
+    World();
+    ~World();
+
+    World(const World&) = delete;
+    World& operator=(const World&) = delete;
+
+    // Entities
+    template<typename... Components>
+    EntityID Create(const Components&... components);
+
+    void Destroy(EntityID entity);
+    bool IsAlive(EntityID entity) const;
+    size_t GetEntityCount() const { return m_EntityCount; }
+
+    // Destroy at the next FlushDeferred (safe during a query)
+    void DeferDestroy(EntityID entity) { m_DeferredDestroys.push_back(entity); }
+    void FlushDeferred();
+
+    // Components. Get returns null when the entity is dead or lacks the component;
+    // Add overwrites a component the entity already has.
+    template<typename T> T* Get(EntityID entity);
+    template<typename T> const T* Get(EntityID entity) const;
+    template<typename T> bool Has(EntityID entity) const;
+    template<typename T> T& Add(EntityID entity, const T& component = T());
+    template<typename T> void Remove(EntityID entity);
+
+    // Queries. Each calls function(EntityID, Components&...) for every entity that has
+    // all the listed components. EachChunk calls function(count, ids, arrays...) once
+    // per chunk, for loops that want the raw arrays.
+    template<typename... Components, typename Function>
+    void Each(Function&& function);
+
+    template<typename... Components, typename Function>
+    void EachChunk(Function&& function);
+
+    // Drop every entity (chunks are kept for reuse)
+    void Clear();
+
+    // Type ids are assigned on first use and shared by every World
+    template<typename T>
+    static uint32_t GetComponentType();
+
+    template<typename... Components>
+    static ComponentMask GetComponentMask();
+
+private:
+    struct Chunk
+    {
+        alignas(64) uint8_t Data[CHUNK_BYTES];
+        uint32_t Count = 0;
+    };
+
+    struct Archetype
+    {
+        ComponentMask Mask = 0;
+        std::vector<uint32_t> Types;                 // Ascending component type ids
+        std::array<uint32_t, MAX_COMPONENT_TYPES> Offsets;  // Byte offset of each type's array in a chunk
+        uint32_t ChunkCapacity = 0;
+
+        // Chunks [0, UsedChunks) hold entities and all but the last are full; the
+        // rest are kept empty for reuse
+        std::vector<std::unique_ptr<Chunk>> Chunks;
+        uint32_t UsedChunks = 0;
+
+        // Archetype reached by adding / removing a component type (filled lazily)
+        std::array<Archetype*, MAX_COMPONENT_TYPES> AddEdges;
+        std::array<Archetype*, MAX_COMPONENT_TYPES> RemoveEdges;
+
+        bool Has(uint32_t type) const { return (Mask >> type) & 1; }
+        EntityID* GetEntities(Chunk& chunk) const { return reinterpret_cast<EntityID*>(chunk.Data); }
+        void* GetColumn(Chunk& chunk, uint32_t type) const { return chunk.Data + Offsets[type]; }
+    };
+
+    struct EntityRecord
+    {
+        Archetype* Owner = nullptr;  // Null while the slot is free
+        uint32_t Chunk = 0;
+        uint32_t Row = 0;
+        uint32_t Generation = 0;
+    };
+
+    struct ComponentInfo
+    {
+        size_t Size;
+        size_t Alignment;
+    };
+
+    static uint32_t RegisterComponentType(size_t size, size_t alignment);
+    static std::vector<ComponentInfo>& GetComponentInfos();
+
+    // Type-erased core the templates above go through
+    EntityID CreateEntity(ComponentMask mask);  // Component values are left for the caller to fill
+    void* GetComponent(EntityID entity, uint32_t type) const;
+    void* AddComponent(EntityID entity, uint32_t type);  // Returns the slot to write, existing or new
+    void RemoveComponent(EntityID entity, uint32_t type);
+
+    Archetype* GetArchetype(ComponentMask mask);
+    const std::vector<Archetype*>& GetMatching(ComponentMask mask);
+
+    // Rows
+    void AllocateRow(Archetype* archetype, EntityID entity, uint32_t& outChunk, uint32_t& outRow);
+    void FreeRow(Archetype* archetype, uint32_t chunk, uint32_t row);
+    void MoveEntity(EntityID entity, Archetype* target);
+
+    const EntityRecord* GetRecord(EntityID entity) const;
+
+    template<typename Function, typename... Components>
+    static void EachInChunk(Function& function, uint32_t count, const EntityID* entities, Components*... columns);
+
+    std::vector<std::unique_ptr<Archetype>> m_Archetypes;
+    std::unordered_map<ComponentMask, Archetype*> m_ArchetypesByMask;
+
+    // Archetypes matching each query mask seen so far, kept up to date as archetypes appear
+    std::unordered_map<ComponentMask, std::vector<Archetype*>> m_Queries;
+
+    std::vector<EntityRecord> m_Records;
+    std::vector<uint32_t> m_FreeIndices;
+    std::vector<EntityID> m_DeferredDestroys;
+    size_t m_EntityCount = 0;
+
+    // Structural changes are not allowed while this is non-zero
+    int m_Iterating = 0;
+};
+
+// ============================================
+// Template implementations
+// ============================================
+
+template<typename T>
+uint32_t World::GetComponentType()
+{
+    static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                  "Components must be plain data");
+    static_assert(sizeof(T) <= CHUNK_BYTES / 16, "Component too large for a chunk");
+
+    static const uint32_t type = RegisterComponentType(sizeof(T), alignof(T));
+    return type;
+}
+
+template<typename... Components>
+ComponentMask World::GetComponentMask()
+{
+    return (ComponentMask(0) | ... | (ComponentMask(1) << GetComponentType<Components>()));
+}
+
+template<typename... Components>
+EntityID World::Create(const Components&... components)
+{
+    EntityID entity = CreateEntity(GetComponentMask<Components...>());
+    (std::memcpy(GetComponent(entity, GetComponentType<Components>()), &components, sizeof(Components)), ...);
+    return entity;
+}
+
+template<typename T>
+T* World::Get(EntityID entity)
+{
+    return static_cast<T*>(GetComponent(entity, GetComponentType<T>()));
+}
+
+template<typename T>
+const T* World::Get(EntityID entity) const
+{
+    return static_cast<const T*>(GetComponent(entity, GetComponentType<T>()));
+}
+
+template<typename T>
+bool World::Has(EntityID entity) const
+{
+    return GetComponent(entity, GetComponentType<T>()) != nullptr;
+}
+
+template<typename T>
+T& World::Add(EntityID entity, const T& component)
+{
+    void* slot = AddComponent(entity, GetComponentType<T>());
+    assert(slot && "Add on a dead entity");
+    std::memcpy(slot, &component, sizeof(T));
+    return *static_cast<T*>(slot);
+}
+
+template<typename T>
+void World::Remove(EntityID entity)
+{
+    RemoveComponent(entity, GetComponentType<T>());
+}
+
+template<typename Function, typename... Components>
+void World::EachInChunk(Function& function, uint32_t count, const EntityID* entities, Components*... columns)
+{
+    for (uint32_t row = 0; row < count; row++)
+        function(entities[row], columns[row]...);
+}
+
+template<typename... Components, typename Function>
+void World::Each(Function&& function)
+{
+    EachChunk<Components...>([&](uint32_t count, const EntityID* entities, Components*... columns)
+    {
+        EachInChunk(function, count, entities, columns...);
+    });
+}
+
+template<typename... Components, typename Function>
+void World::EachChunk(Function&& function)
+{
+    const std::vector<Archetype*>& matching = GetMatching(GetComponentMask<Components...>());
+
+    m_Iterating++;
+    for (Archetype* archetype : matching)
+    {
+        for (uint32_t i = 0; i < archetype->UsedChunks; i++)
+        {
+            Chunk& chunk = *archetype->Chunks[i];
+            function(chunk.Count, archetype->GetEntities(chunk),
+                     static_cast<Components*>(archetype->GetColumn(chunk, GetComponentType<Components>()))...);
+        }
+    }
+    m_Iterating--;
+}
@@ -5,6 +5,7 @@
 #include <memory>
 
 class Collider;
+class RigidBody;
 
 // Base class for all game objects
 class Entity
@@ -48,6 +49,10 @@ public:
     Collider* GetCollider() const { return m_Collider.get(); }
     void SetCollider(std::unique_ptr<Collider> collider);
 
+    // Rigid body (moved by Physics::Step)
+    RigidBody* GetRigidBody() const { return m_RigidBody.get(); }
+    void SetRigidBody(std::unique_ptr<RigidBody> body);
+
 protected:
     std::string m_Name;
     glm::vec2 m_Position;
@@ -56,4 +61,5 @@ protected:
     bool m_Active;
 
     std::unique_ptr<Collider> m_Collider;
+    std::unique_ptr<RigidBody> m_RigidBody;
 };
\ No newline at end of file
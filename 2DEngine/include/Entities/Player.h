@@ -30,7 +30,11 @@ public:
     void SetSize(const glm::vec2& size) { m_Size = size; }
     const glm::vec2& GetSize() const { return m_Size; }
 
-    const glm::vec2& GetVelocity() const { return m_Velocity; }
+    // Steering sets the rigid body's velocity; Physics::Step moves the player
+    const glm::vec2& GetVelocity() const;
+
+    // Zero the velocity, for games that stop calling Update (pause, cutscenes)
+    void Stop();
 
     // Texture support
     void SetTexture(const std::string& path);
@@ -38,7 +42,6 @@ public:
 
 private:
     // Physics
-    glm::vec2 m_Velocity;
     float m_MaxSpeed;
     float m_Acceleration;
     float m_Deceleration;
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Physics/CollisionFilter.h"
+#include "Physics/Raycast.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+// Refers to a live projectile. Once it dies its slot's generation moves on and the
+// handle no longer resolves (same scheme as ColliderHandle).
+struct ProjectileHandle
+{
+    static constexpr uint32_t INVALID_SLOT = 0xFFFFFFFF;
+
+    uint32_t Slot = INVALID_SLOT;
+    uint32_t Generation = 0;
+
+    bool IsNull() const { return Slot == INVALID_SLOT; }
+    bool operator==(const ProjectileHandle& other) const { return Slot == other.Slot && Generation == other.Generation; }
+    bool operator!=(const ProjectileHandle& other) const { return !(*this == other); }
+};
+
+struct ProjectileDesc
+{
+    glm::vec2 Position = glm::vec2(0.0f);
+    glm::vec2 Velocity = glm::vec2(0.0f);       // Units per second
+    glm::vec2 Size = glm::vec2(4.0f, 12.0f);    // Box, centered on Position
+    glm::vec4 Color = glm::vec4(1.0f);
+    float Lifetime = 3.0f;                      // Seconds
+
+    // Layers of the shooter's shots, as for a Collider (see CollisionFilter.h)
+    uint32_t Category = COLLISION_DEFAULT_CATEGORY;
+    uint32_t Mask = COLLISION_ALL_LAYERS;
+};
+
+// Bullets without an Entity, Collider or Physics registration each. Projectiles live in
+// fixed-capacity pools stored as separate arrays (position, previous position, velocity,
+// lifetime, size, color, layers), kept packed so Update and Render stream through them.
+// Nothing is allocated after Init.
+class ProjectileSystem
+{
+public:
+    static constexpr uint32_t DEFAULT_CAPACITY = 1024;
+
+    static void Init(uint32_t capacity = DEFAULT_CAPACITY);
+    static void Shutdown();
+
+    // Null handle when the pool is full
+    static ProjectileHandle Spawn(const ProjectileDesc& desc);
+
+    static void Kill(ProjectileHandle projectile);
+    static bool IsAlive(ProjectileHandle projectile);
+    static void Clear();
+
+    // Move every projectile by its velocity and drop the ones whose lifetime ran out
+    static void Update(float deltaTime);
+
+    // Sweep each projectile's box along this update's move against Physics and call
+    // onHit(ProjectileHandle, const RaycastHit&) for the first collider it touches.
+    // Return true from the callback to remove the projectile (hit consumed). The
+    // callback may call Clear but must not spawn or kill other projectiles.
+    template<typename Callback>
+    static void Collide(Callback&& onHit);
+
+    // One instanced draw for all projectiles, inside a Renderer scene
+    static void Render();
+
+    static uint32_t GetCount();
+    static uint32_t GetCapacity();
+
+private:
+    using HitFunction = bool (*)(void* context, ProjectileHandle projectile, const RaycastHit& hit);
+
+    static void DispatchHits(HitFunction function, void* context);
+
+    static void RemoveAt(uint32_t index);
+
+    struct ProjectileData;
+    static std::unique_ptr<ProjectileData> s_Data;
+};
+
+// ============================================
+// Template implementations
+// ============================================
+
+template<typename Callback>
+void ProjectileSystem::Collide(Callback&& onHit)
+{
+    // Passed by pointer rather than as a std::function, so capturing lambdas never allocate
+    using CallbackType = std::remove_reference_t<Callback>;
+    DispatchHits(
+        [](void* context, ProjectileHandle projectile, const RaycastHit& hit)
+        {
+            return (bool)(*static_cast<CallbackType*>(context))(projectile, hit);
+        },
+        const_cast<void*>(static_cast<const void*>(&onHit)));
+}
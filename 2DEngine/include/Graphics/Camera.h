@@ -7,8 +7,16 @@ class Camera
 public:
     Camera(float width, float height);
 
-    // Get the view-projection matrix
-    const glm::mat4& GetViewProjectionMatrix() const { return m_ViewProjectionMatrix; }
+    // Derived matrices are cached and only rebuilt after position/zoom/size change
+    const glm::mat4& GetViewProjectionMatrix() const;
+    const glm::mat4& GetInverseViewProjectionMatrix() const;
+
+    // World-space rectangle the camera sees (minX, minY, maxX, maxY)
+    const glm::vec4& GetVisibleBounds() const;
+    bool IsBoxVisible(const glm::vec2& center, const glm::vec2& size) const;
+
+    // Map normalized device coordinates (-1..1 within this camera's viewport) to world space
+    glm::vec2 NdcToWorld(const glm::vec2& ndc) const;
 
     // Camera position in world space
     void SetPosition(const glm::vec2& position);
@@ -18,20 +26,38 @@ public:
     void SetZoom(float zoom);
     float GetZoom() const { return m_Zoom; }
 
-    // Update camera (call this if you change position or zoom)
+    // Force the cached matrices to be rebuilt now (setters already mark them dirty)
     void RecalculateViewProjection();
 
     // Screen dimensions
     void SetViewportSize(float width, float height);
 
+    // Region of the framebuffer this camera renders to, normalized (x, y, width, height)
+    // with the origin at the bottom-left. Defaults to the whole window.
+    void SetViewportRect(const glm::vec4& rect) { m_ViewportRect = rect; }
+    const glm::vec4& GetViewportRect() const { return m_ViewportRect; }
+
+    // Inactive cameras are skipped by the engine's render passes
+    void SetActive(bool active) { m_IsActive = active; }
+    bool IsActive() const { return m_IsActive; }
+
 private:
-    glm::mat4 m_ProjectionMatrix;
-    glm::mat4 m_ViewMatrix;
-    glm::mat4 m_ViewProjectionMatrix;
+    void UpdateIfDirty() const;
+    void Rebuild() const;
+
+    mutable glm::mat4 m_ProjectionMatrix;
+    mutable glm::mat4 m_ViewMatrix;
+    mutable glm::mat4 m_ViewProjectionMatrix;
+    mutable glm::mat4 m_InverseViewProjectionMatrix;
+    mutable glm::vec4 m_VisibleBounds;
+    mutable bool m_IsDirty;
 
     glm::vec2 m_Position;
     float m_Zoom;
 
     float m_Width;
     float m_Height;
-};
\ No newline at end of file
+
+    glm::vec4 m_ViewportRect;
+    bool m_IsActive;
+};
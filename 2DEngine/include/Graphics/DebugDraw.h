@@ -0,0 +1,80 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+
+// Set to 0 (CMake option ENGINE_DEBUG_DRAW=OFF) to compile every DebugDraw call to nothing
+#ifndef ENGINE_DEBUG_DRAW
+#define ENGINE_DEBUG_DRAW 1
+#endif
+
+#if ENGINE_DEBUG_DRAW
+
+// Immediate-mode overlay shapes (physics shapes, AI state, timings). Calls during a
+// frame only append vertices to one stream; Render draws all of it in a single draw
+// call on top of the scene, and NewFrame starts over. World coordinates, sizes and
+// thicknesses in world units.
+class DebugDraw
+{
+public:
+    static void Init();
+    static void Shutdown();
+
+    static void Line(const glm::vec2& from, const glm::vec2& to, const glm::vec4& color, float thickness = 1.0f);
+
+    // Rects are centered on 'center' (like Renderer::DrawQuad)
+    static void Rect(const glm::vec2& center, const glm::vec2& size, const glm::vec4& color, float thickness = 1.0f);
+    static void FilledRect(const glm::vec2& center, const glm::vec2& size, const glm::vec4& color);
+
+    // Anti-aliased in the fragment shader from the distance to the center
+    static void Circle(const glm::vec2& center, float radius, const glm::vec4& color, float thickness = 1.0f);
+    static void FilledCircle(const glm::vec2& center, float radius, const glm::vec4& color);
+
+    // Built-in bitmap font, left aligned, 'position' is the top-left of the first line
+    static void Text(std::string_view text, const glm::vec2& position, const glm::vec4& color, float scale = 1.0f);
+
+    // printf-style, truncated to FORMAT_BUFFER_SIZE - 1 characters
+    static void Textf(const glm::vec2& position, const glm::vec4& color, float scale, const char* format, ...);
+
+    static constexpr size_t FORMAT_BUFFER_SIZE = 256;
+
+    // Draw everything queued so far this frame. Uploads the stream on the first call
+    // after a change, so several camera passes can each draw it.
+    static void Render(const glm::mat4& viewProjection);
+
+    // Drop the queued shapes (the Engine calls this once a frame is presented)
+    static void NewFrame();
+
+    static size_t GetVertexCount();
+
+private:
+    struct DebugDrawData;
+    static std::unique_ptr<DebugDrawData> s_Data;
+};
+
+#else
+
+class DebugDraw
+{
+public:
+    static void Init() {}
+    static void Shutdown() {}
+
+    static void Line(const glm::vec2&, const glm::vec2&, const glm::vec4&, float = 1.0f) {}
+    static void Rect(const glm::vec2&, const glm::vec2&, const glm::vec4&, float = 1.0f) {}
+    static void FilledRect(const glm::vec2&, const glm::vec2&, const glm::vec4&) {}
+    static void Circle(const glm::vec2&, float, const glm::vec4&, float = 1.0f) {}
+    static void FilledCircle(const glm::vec2&, float, const glm::vec4&) {}
+    static void Text(std::string_view, const glm::vec2&, const glm::vec4&, float = 1.0f) {}
+    static void Textf(const glm::vec2&, const glm::vec4&, float, const char*, ...) {}
+
+    static constexpr size_t FORMAT_BUFFER_SIZE = 256;
+
+    static void Render(const glm::mat4&) {}
+    static void NewFrame() {}
+    static size_t GetVertexCount() { return 0; }
+};
+
+#endif
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+enum class FontType
+{
+    Bitmap,  // Hard-edged pixel glyphs (built-in font)
+    SDF      // Signed distance field glyphs, crisp at any scale
+};
+
+// Placement of one glyph in a font atlas (all metrics in atlas texels)
+struct Glyph
+{
+    glm::vec2 Size = glm::vec2(0.0f);       // Quad size
+    glm::vec2 Bearing = glm::vec2(0.0f);    // Pen position to quad top-left (Y up)
+    float Advance = 0.0f;                   // Pen advance to the next glyph
+    glm::vec4 AtlasRect = glm::vec4(0.0f);  // Texel bounds (minX, minY, maxX, maxY), rows top-down
+    uint32_t Page = 0;                      // Atlas page holding the bitmap
+};
+
+struct GlyphCacheStats
+{
+    uint64_t Hits = 0;       // Lookups served by a resident glyph
+    uint64_t Misses = 0;     // Lookups that had to rasterize (a codepoint with no glyph counts once)
+    uint64_t Evictions = 0;  // Pages recycled because the page budget was reached
+    uint32_t PageCount = 0;  // Pages currently allocated, including the baked page
+};
+
+class Font
+{
+public:
+    Font(FontType type, float unitsPerTexel);
+    ~Font();
+
+    Font(const Font&) = delete;
+    Font& operator=(const Font&) = delete;
+
+    // Load a TrueType font and build its SDF atlas at the given raster height.
+    // The atlas and metrics are cached on disk keyed by the font file hash.
+    static std::unique_ptr<Font> LoadTTF(const std::string& path, unsigned int pixelHeight);
+
+    // Where generated SDF atlases are cached (defaults to the temp directory)
+    static void SetCacheDirectory(const std::string& directory);
+
+    // Upload the baked single-channel atlas (page 0, rows top-down) and register glyphs
+    void SetAtlas(const unsigned char* pixels, int width, int height);
+    void AddGlyph(uint32_t codepoint, const Glyph& glyph);
+
+    // Glyphs missing from the baked page are rasterized on demand into dynamic pages
+    // (TTF fonts only), so lookups may upload to the GPU and evict old pages
+    const Glyph* GetGlyph(uint32_t codepoint) const;
+
+    FontType GetType() const { return m_Type; }
+    uint32_t GetID() const { return m_ID; }
+
+    unsigned int GetAtlasID() const { return GetPageTexture(0); }
+    glm::ivec2 GetAtlasSize() const { return m_Pages.empty() ? glm::ivec2(0) : m_Pages[0].Size; }
+
+    // Atlas pages; a page's generation changes whenever it is evicted and reused
+    uint32_t GetPageCount() const { return (uint32_t)m_Pages.size(); }
+    unsigned int GetPageTexture(uint32_t page) const { return page < m_Pages.size() ? m_Pages[page].TextureID : 0; }
+    uint32_t GetPageGeneration(uint32_t page) const { return page < m_Pages.size() ? m_Pages[page].Generation : 0; }
+    void TouchPage(uint32_t page) const;  // Mark a page as recently drawn
+
+    // Maximum number of dynamic pages (not counting the baked page) before LRU eviction
+    void SetPageBudget(uint32_t pages);
+    uint32_t GetPageBudget() const { return m_PageBudget; }
+
+    const GlyphCacheStats& GetCacheStats() const { return m_Stats; }
+    void ResetCacheStats();
+
+    // World units covered by one atlas texel at the given text scale
+    float GetTexelSize(float scale) const { return m_UnitsPerTexel * scale; }
+
+    // Vertical metrics (texels)
+    void SetLineMetrics(float lineHeight, float lineAdvance);
+    float GetLineHeight() const { return m_LineHeight; }
+    float GetLineAdvance() const { return m_LineAdvance; }
+
+    // Advance used for characters the font has no glyph for
+    void SetFallbackAdvance(float advance) { m_FallbackAdvance = advance; }
+    float GetFallbackAdvance() const { return m_FallbackAdvance; }
+
+    // SDF only: texels of distance per unit of normalized atlas value
+    void SetDistanceScale(float scale) { m_DistanceScale = scale; }
+    float GetDistanceScale() const { return m_DistanceScale; }
+
+private:
+    struct AtlasPage
+    {
+        unsigned int TextureID = 0;
+        glm::ivec2 Size = glm::ivec2(0);
+
+        // Shelf packer: glyphs fill the open shelf left to right, then a new shelf starts below
+        int PenX = 1;
+        int PenY = 1;
+        int ShelfHeight = 0;
+
+        uint32_t Generation = 0;
+        uint64_t LastUsed = 0;
+        bool Pinned = false;  // The baked page is never evicted
+    };
+
+    struct GlyphSource;  // TrueType data used to rasterize glyphs on demand
+
+    const Glyph* RasterizeGlyph(uint32_t codepoint) const;
+    bool AllocateRect(int width, int height, uint32_t& outPage, glm::ivec2& outPos) const;
+    uint32_t CreatePage() const;
+    void EvictPage(uint32_t page) const;
+
+    FontType m_Type;
+    uint32_t m_ID;
+    float m_UnitsPerTexel;
+
+    float m_LineHeight;
+    float m_LineAdvance;
+    float m_FallbackAdvance;
+    float m_DistanceScale;
+
+    // Baked ASCII lookups are a plain array; everything else goes through the map.
+    // Residency is a cache, so const lookups may fill or evict it.
+    Glyph m_AsciiGlyphs[128];
+    bool m_HasAsciiGlyph[128];
+    mutable std::unordered_map<uint32_t, Glyph> m_Glyphs;
+    mutable std::unordered_set<uint32_t> m_MissingGlyphs;  // Codepoints that failed to rasterize
+
+    mutable std::vector<AtlasPage> m_Pages;
+    mutable GlyphCacheStats m_Stats;
+    mutable uint64_t m_UseClock;
+    uint32_t m_PageBudget;
+
+    std::unique_ptr<GlyphSource> m_Source;
+};
@@ -33,6 +33,12 @@ public:
     static void BeginScene(const glm::mat4& viewProjection);
     static void EndScene();
 
+    // Active scene state for subsystems that draw with their own shader
+    static const glm::mat4& GetViewProjectionMatrix();
+
+    // Re-bind the quad shader after another shader was used mid-scene
+    static void BindQuadShader();
+
     // Draw quads
     static void DrawQuad(const Quad& quad);
 
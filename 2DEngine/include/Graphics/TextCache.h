@@ -0,0 +1,91 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Graphics/TextLayout.h"
+
+class Font;
+
+// One vertex of a tessellated glyph quad
+struct TextVertex
+{
+    glm::vec2 Position;   // Relative to the text origin
+    glm::vec2 TexCoord;   // Font atlas position, in texels
+    glm::vec4 GlyphRect;  // Atlas texel bounds of the glyph (minX, minY, maxX, maxY)
+    glm::vec2 Corner;     // Quad corner (-1/+1), used to grow the quad for outlines/shadows
+};
+
+// Vertices of a mesh that sample one atlas page (one draw call each)
+struct TextMeshRange
+{
+    uint32_t Page;
+    uint32_t Generation;  // Page generation the vertices were built against
+    int FirstVertex;
+    int VertexCount;
+};
+
+// Vertex data for a string that stays on the GPU until it is evicted
+struct TextMesh
+{
+    TextMesh() = default;
+    ~TextMesh();
+
+    TextMesh(const TextMesh&) = delete;
+    TextMesh& operator=(const TextMesh&) = delete;
+
+    unsigned int VAO = 0;
+    unsigned int VBO = 0;
+    int VertexCount = 0;
+    std::vector<TextMeshRange> Ranges;  // Sorted by page
+
+    TextLayoutHandle Layout;           // Glyph positions the mesh was built from
+    glm::vec4 Color = glm::vec4(1.0f);
+    glm::vec2 Size = glm::vec2(0.0f);  // Width of the longest line, height of all lines
+    float TexelSize = 1.0f;            // World units per atlas texel
+
+    mutable uint64_t LastUsedFrame = 0;
+};
+
+// Handles keep a mesh alive even after the cache drops it
+using TextMeshHandle = std::shared_ptr<TextMesh>;
+
+// Caches tessellated text so static and slowly changing strings
+// are only laid out and uploaded when their content changes
+class TextCache
+{
+public:
+    static void Init();
+    static void Shutdown();
+    static bool IsInitialized() { return s_Data != nullptr; }
+
+    // Get (or build) the mesh for this string/scale/color (nullptr font = active font)
+    static TextMeshHandle Get(std::string_view text, float scale, const glm::vec4& color,
+                              const Font* font = nullptr);
+
+    // Same, with wrapping/alignment; the layout itself comes from TextLayoutCache
+    static TextMeshHandle Get(std::string_view text, const TextLayoutParams& params, const glm::vec4& color);
+
+    // Mesh for a layout the caller already has (e.g. one it also uses for hit-testing)
+    static TextMeshHandle Get(const TextLayoutHandle& layout, const glm::vec4& color);
+
+    // False once a glyph page the mesh samples has been evicted from the font atlas
+    static bool IsCurrent(const TextMesh& mesh);
+
+    // Call once per frame; drops entries that were not drawn recently
+    static void NewFrame();
+
+    // Number of frames an entry may go unused before it is evicted
+    static void SetEvictAfterFrames(uint32_t frames);
+
+    static uint64_t GetFrameIndex();
+    static size_t GetEntryCount();
+    static void Clear();
+
+private:
+    struct CacheData;
+    static std::unique_ptr<CacheData> s_Data;
+};
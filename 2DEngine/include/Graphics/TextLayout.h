@@ -0,0 +1,107 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class Font;
+
+// Horizontal alignment of each line relative to the layout origin:
+// Left starts at the origin, Center is centered on it, Right ends at it
+enum class TextAlign
+{
+    Left,
+    Center,
+    Right
+};
+
+struct TextLayoutParams
+{
+    explicit TextLayoutParams(float scale = 1.0f, TextAlign align = TextAlign::Left,
+                     float maxWidth = 0.0f, const Font* font = nullptr)
+        : Scale(scale), Align(align), MaxWidth(maxWidth), LayoutFont(font) {}
+
+    float Scale;
+    TextAlign Align;
+    float MaxWidth;          // World units, 0 = never wrap
+    const Font* LayoutFont;  // nullptr = TextRenderer's active font
+};
+
+// One positioned glyph (pen position at the top of its line, relative to the layout origin)
+struct LayoutGlyph
+{
+    uint32_t Codepoint;  // Decoded from UTF-8
+    uint32_t ByteIndex;  // Offset of the character's first byte in the source text
+    glm::vec2 Position;
+    float Advance;
+};
+
+struct LayoutLine
+{
+    uint32_t FirstGlyph;
+    uint32_t GlyphCount;
+    uint32_t ByteBegin;  // Source text range, excluding the line break
+    uint32_t ByteEnd;
+    float Width;         // Without trailing spaces
+    float LineTop;       // Lines stack downwards from the origin
+};
+
+// Result of laying out a string: shared between measuring, rendering and hit-testing
+struct TextLayout
+{
+    std::string Text;
+    TextLayoutParams Params;
+    const Font* LayoutFont = nullptr;  // Resolved font
+    uint64_t Hash = 0;
+
+    std::vector<LayoutGlyph> Glyphs;
+    std::vector<LayoutLine> Lines;
+
+    glm::vec2 Size = glm::vec2(0.0f);    // Widest line, height of all lines
+    glm::vec2 BoundsMin = glm::vec2(0.0f);  // Glyph quad bounds relative to the origin
+    glm::vec2 BoundsMax = glm::vec2(0.0f);
+
+    mutable uint64_t LastUsedFrame = 0;
+
+    // True if this layout was built from exactly these inputs
+    bool Matches(std::string_view text, const TextLayoutParams& params, const Font* font) const;
+
+    glm::vec2 GetCenter() const { return (BoundsMin + BoundsMax) * 0.5f; }
+
+    // Byte index of the caret position closest to a point (relative to the origin),
+    // or -1 if the point is above/below all lines
+    int HitTest(const glm::vec2& localPoint) const;
+};
+
+using TextLayoutHandle = std::shared_ptr<const TextLayout>;
+
+// Memoizes layouts by content hash so a string is only measured/wrapped
+// again when its text or layout parameters change
+class TextLayoutCache
+{
+public:
+    static void Init();
+    static void Shutdown();
+
+    static TextLayoutHandle Get(std::string_view text, const TextLayoutParams& params = TextLayoutParams());
+
+    // Lay out into caller-owned storage, bypassing the cache. The layout's buffers are
+    // reused, so text that changes every frame stops allocating once they have grown.
+    static bool BuildInto(std::string_view text, const TextLayoutParams& params, TextLayout& outLayout);
+
+    // Content hash a layout of these inputs would get (font must already be resolved)
+    static uint64_t ComputeKey(std::string_view text, const TextLayoutParams& params, const Font& font);
+
+    // Call once per frame; drops layouts that were not used recently
+    static void NewFrame();
+
+    static size_t GetEntryCount();
+    static void Clear();
+
+private:
+    struct CacheData;
+    static std::unique_ptr<CacheData> s_Data;
+};
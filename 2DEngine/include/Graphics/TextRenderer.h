@@ -2,11 +2,25 @@
 
 #include <glm/glm.hpp>
 #include <string>
+#include <string_view>
 #include <map>
 #include <memory>
+#include <vector>
+#include "Graphics/TextLayout.h"
 
 class Shader;
 class Texture;
+class Font;
+struct TextMesh;
+struct TextVertex;
+
+// Lets the compiler check printf-style format strings against their arguments
+// (index is 1-based; static member functions have no implicit 'this')
+#if defined(__GNUC__) || defined(__clang__)
+    #define TEXT_PRINTF_FORMAT(formatIndex, firstArg) __attribute__((format(printf, formatIndex, firstArg)))
+#else
+    #define TEXT_PRINTF_FORMAT(formatIndex, firstArg)
+#endif
 
 struct Character
 {
@@ -16,25 +30,91 @@ struct Character
     unsigned int Advance;    // Offset to advance to next glyph
 };
 
+// Optional per-draw effects, resolved in the text fragment shader so an
+// outlined or shadowed string costs one draw like a plain one.
+// Effects wider than the one-pixel glyph spacing may overlap neighbouring glyphs.
+struct TextEffects
+{
+    float OutlineWidth = 0.0f;                            // World units, 0 = no outline
+    glm::vec4 OutlineColor = glm::vec4(1.0f);
+    glm::vec2 ShadowOffset = glm::vec2(0.0f);             // World units, (0,0) = no shadow
+    glm::vec4 ShadowColor = glm::vec4(0.0f, 0.0f, 0.0f, 0.6f);
+};
+
 class TextRenderer
 {
 public:
     static void Init();
     static void Shutdown();
 
-    // Load a font from file (requires FreeType)
+    // Load a TrueType font as an SDF atlas and make it the active font.
+    // Returns false (and keeps the current font) if the font could not be loaded.
     static bool LoadFont(const std::string& fontPath, unsigned int fontSize);
 
-    // Render text at position (screen coordinates or world coordinates depending on camera)
-    static void RenderText(const std::string& text, 
-                          glm::vec2 position, 
+    // Font used by RenderText/TextCache when none is given; nullptr restores the built-in font
+    static void SetActiveFont(Font* font);
+    static Font* GetActiveFont();
+    static Font* GetBuiltinFont();
+
+    // Render UTF-8 text at position (screen coordinates or world coordinates depending on camera)
+    // Goes through TextCache, so unchanged strings are not re-tessellated
+    static void RenderText(std::string_view text,
+                          glm::vec2 position,
                           float scale = 1.0f,
-                          glm::vec4 color = glm::vec4(1.0f));
+                          glm::vec4 color = glm::vec4(1.0f),
+                          const TextEffects& effects = TextEffects());
+
+    // Render wrapped and/or aligned text (alignment is relative to position)
+    static void RenderText(std::string_view text,
+                          glm::vec2 position,
+                          const TextLayoutParams& params,
+                          glm::vec4 color = glm::vec4(1.0f),
+                          const TextEffects& effects = TextEffects());
+
+    // printf-style text formatted into a fixed stack buffer (output longer than
+    // FORMAT_BUFFER_SIZE - 1 characters is truncated).
+    // RenderTextf and RenderNumber are meant for values that change every frame, so they
+    // skip TextCache: the text is laid out into reused scratch storage and streamed through
+    // one shared vertex buffer, and a steady HUD makes no heap allocations.
+    static void RenderTextf(glm::vec2 position, float scale, glm::vec4 color, const char* format, ...)
+        TEXT_PRINTF_FORMAT(4, 5);
+    static void RenderTextf(glm::vec2 position, const TextLayoutParams& params, glm::vec4 color, const char* format, ...)
+        TEXT_PRINTF_FORMAT(4, 5);
+
+    // "<label><value>" (e.g. "Score:1200") built with std::to_chars on the stack
+    static void RenderNumber(std::string_view label, long long value,
+                            glm::vec2 position,
+                            float scale = 1.0f,
+                            glm::vec4 color = glm::vec4(1.0f),
+                            const TextEffects& effects = TextEffects());
+
+    static void RenderNumber(std::string_view label, long long value,
+                            glm::vec2 position,
+                            const TextLayoutParams& params,
+                            glm::vec4 color = glm::vec4(1.0f),
+                            const TextEffects& effects = TextEffects());
+
+    static constexpr size_t FORMAT_BUFFER_SIZE = 256;
+
+    // Render a mesh previously obtained from TextCache::Get.
+    // Glyphs on evicted atlas pages are skipped; refetch when !TextCache::IsCurrent(mesh)
+    static void RenderText(const TextMesh& mesh, glm::vec2 position,
+                          const TextEffects& effects = TextEffects());
 
     // Get text width for layout calculations
-    static float GetTextWidth(const std::string& text, float scale = 1.0f);
+    static float GetTextWidth(std::string_view text, float scale = 1.0f, const Font* font = nullptr);
+
+    // Tessellate a layout into glyph quads relative to the text origin (used by TextCache)
+    static void BuildTextVertices(const TextLayout& layout, std::vector<TextVertex>& outVertices, TextMesh& outMesh);
+
+    // Describe TextVertex to the bound vertex array (VBO must be bound to GL_ARRAY_BUFFER)
+    static void SetVertexAttributes();
 
 private:
+    // Uncached path behind RenderTextf/RenderNumber
+    static void RenderStreamedText(std::string_view text, glm::vec2 position, const TextLayoutParams& params,
+                                   glm::vec4 color, const TextEffects& effects);
+
     struct TextData;
     static std::unique_ptr<TextData> s_Data;
-};
\ No newline at end of file
+};
@@ -17,6 +17,7 @@ public:
     int GetWidth() const { return m_Width; }
     int GetHeight() const { return m_Height; }
     unsigned int GetID() const { return m_RendererID; }
+    const std::string& GetPath() const { return m_Path; }  // Empty if not loaded from a file
 
 private:
     unsigned int m_RendererID;
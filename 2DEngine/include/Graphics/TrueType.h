@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Reads what the text renderer needs from a TrueType font: the character map,
+// horizontal metrics and quadratic ('glyf') outlines, rendered as signed distance
+// fields. CFF-flavoured OpenType fonts and hinting are not supported. Every read is
+// bounds checked, so a damaged file gives missing glyphs rather than a crash.
+// The font data is not copied and must outlive this object.
+class TrueTypeFont
+{
+public:
+    TrueTypeFont();
+
+    // Parses the table directory (the first font of a collection).
+    // Returns false if the data isn't a usable TrueType font.
+    bool Init(const unsigned char* data, size_t size);
+
+    // Font units -> pixels for a line (ascent to descent) this many pixels tall
+    float ScaleForPixelHeight(float pixels) const;
+
+    // Vertical metrics in font units, Y up
+    int GetAscent() const { return m_Ascent; }
+    int GetDescent() const { return m_Descent; }
+    int GetLineGap() const { return m_LineGap; }
+
+    // 0 (the missing-glyph box) when the font has no glyph for the codepoint
+    uint32_t FindGlyphIndex(uint32_t codepoint) const;
+    void GetGlyphHMetrics(uint32_t glyph, int& outAdvance, int& outLeftBearing) const;
+
+    // Distance field of one glyph, 'padding' texels larger than its outline on each side
+    // (rows top-down). Texels on the outline hold onEdgeValue, which rises inside the glyph
+    // by pixelDistScale per texel of distance. The offsets place the top-left texel
+    // relative to the pen on the baseline, Y down. Returns false for glyphs without an
+    // outline (whitespace).
+    bool RenderGlyphSDF(uint32_t glyph, float scale, int padding, unsigned char onEdgeValue, float pixelDistScale,
+                        std::vector<unsigned char>& outPixels, int& outWidth, int& outHeight,
+                        int& outXOffset, int& outYOffset) const;
+
+private:
+    struct Point
+    {
+        float X, Y;
+    };
+
+    // Maps component glyph points into the parent glyph: (A*x + C*y + E, B*x + D*y + F)
+    struct Transform
+    {
+        float A = 1.0f, B = 0.0f, C = 0.0f, D = 1.0f, E = 0.0f, F = 0.0f;
+    };
+
+    uint8_t ReadU8(size_t offset) const;
+    uint16_t ReadU16(size_t offset) const;
+    int16_t ReadI16(size_t offset) const { return (int16_t)ReadU16(offset); }
+    uint32_t ReadU32(size_t offset) const;
+
+    bool FindTable(const char* tag, size_t& outOffset, size_t& outLength) const;
+    bool GetGlyphRange(uint32_t glyph, size_t& outOffset, size_t& outLength) const;
+
+    // Closed polylines in font units; curves are flattened to within 'tolerance'.
+    // componentBudget caps how many compound components may still be expanded.
+    bool AppendOutline(uint32_t glyph, const Transform& transform, float tolerance, int depth,
+                       int& componentBudget, std::vector<std::vector<Point>>& contours) const;
+
+    const unsigned char* m_Data;
+    size_t m_Size;
+    size_t m_Directory;  // Table directory of the font in use
+
+    size_t m_Glyf, m_GlyfLength;
+    size_t m_Loca, m_Hmtx, m_Cmap;
+    uint16_t m_CmapFormat;
+    bool m_LongLoca;
+    uint32_t m_GlyphCount;
+    uint32_t m_HMetricCount;
+
+    int m_Ascent, m_Descent, m_LineGap;
+};
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+// Axis-aligned bounding box in world space
+struct AABB
+{
+    glm::vec2 Min = glm::vec2(0.0f);
+    glm::vec2 Max = glm::vec2(0.0f);
+
+    AABB() = default;
+    AABB(const glm::vec2& min, const glm::vec2& max) : Min(min), Max(max) {}
+
+    static AABB FromCenter(const glm::vec2& center, const glm::vec2& size)
+    {
+        glm::vec2 half = size * 0.5f;
+        return AABB(center - half, center + half);
+    }
+
+    glm::vec2 GetCenter() const { return (Min + Max) * 0.5f; }
+    glm::vec2 GetSize() const { return Max - Min; }
+
+    // Touching edges count as overlapping (matches the collider tests)
+    bool Overlaps(const AABB& other) const
+    {
+        return Min.x <= other.Max.x && Max.x >= other.Min.x &&
+               Min.y <= other.Max.y && Max.y >= other.Min.y;
+    }
+
+    bool Contains(const glm::vec2& point) const
+    {
+        return point.x >= Min.x && point.x <= Max.x &&
+               point.y >= Min.y && point.y <= Max.y;
+    }
+};
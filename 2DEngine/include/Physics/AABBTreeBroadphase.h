@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Physics/Broadphase.h"
+#include "Physics/DynamicAABBTree.h"
+#include <unordered_map>
+
+// Broadphase backed by a persistent dynamic AABB tree. Colliders keep their
+// tree proxy between builds and are only re-inserted once they leave their
+// fat box, so a mostly static scene costs almost nothing to rebuild.
+class AABBTreeBroadphase : public Broadphase
+{
+public:
+    explicit AABBTreeBroadphase(float margin);
+
+    void Build(const std::vector<Collider*>& colliders) override;
+    void Query(const AABB& bounds, std::vector<uint32_t>& outIndices) const override;
+    void Raycast(const glm::vec2& start, const glm::vec2& end, RaycastVisitor& visitor) const override;
+    BroadphaseType GetType() const override { return BroadphaseType::AABBTree; }
+
+    // Leaves carry the collider's index in the last build as user data
+    const DynamicAABBTree& GetTree() const { return m_Tree; }
+
+private:
+    struct Proxy
+    {
+        int TreeProxy = DynamicAABBTree::NULL_NODE;
+        uint32_t Stamp = 0;       // Build that last saw this collider
+        glm::vec2 Center{ 0.0f }; // Bounds center at that build, for the movement prediction
+    };
+
+    DynamicAABBTree m_Tree;
+    std::unordered_map<const Collider*, Proxy> m_Proxies;
+    uint32_t m_BuildStamp;
+};
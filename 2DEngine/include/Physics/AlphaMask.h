@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// One bit per texel, set where the texel's alpha reaches a threshold. Rows run bottom
+// to top (like world y, and textures as they're loaded), each packed into 64-bit words
+// so overlap tests can compare 64 texels at a time.
+class AlphaMask
+{
+public:
+    AlphaMask(int width, int height);
+
+    // Mask of one frame of a sprite sheet with frameCount frames side by side (the
+    // layout Enemy animates). Built the first time it's asked for and cached, so every
+    // collider using the same texture and frame shares it. nullptr if the image can't
+    // be loaded.
+    static std::shared_ptr<const AlphaMask> Load(const std::string& path, int frameCount = 1, int frame = 0,
+                                                 uint8_t alphaThreshold = 128);
+    static void ClearCache();
+
+    void Set(int x, int y, bool value);
+    bool IsSet(int x, int y) const;
+
+    // 64 texels of row y starting at column x (bit 0 = column x); outside the mask reads as 0
+    uint64_t GetBits(int x, int y) const;
+
+    // Any texel set in row y between columns first and last (inclusive, clamped to the mask)
+    bool AnyInRow(int y, int first, int last) const;
+
+    int GetWidth() const { return m_Width; }
+    int GetHeight() const { return m_Height; }
+
+private:
+    const uint64_t* GetRow(int y) const { return &m_Bits[(size_t)y * m_WordsPerRow]; }
+
+    int m_Width;
+    int m_Height;
+    int m_WordsPerRow;
+    std::vector<uint64_t> m_Bits;  // Bits past the width stay 0
+};
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "Physics/AABB.h"
+#include "Physics/CollisionFilter.h"
+#include <cstdint>
+#include <vector>
+
+// Collider bounds packed as separate arrays (structure of arrays), so overlap
+// tests stream through contiguous floats, 4 or 8 boxes per SIMD instruction,
+// instead of chasing collider -> owner pointers for every pair.
+struct BoundsSoA
+{
+    enum Flag : uint32_t
+    {
+        FLAG_CIRCLE = 1 << 0,    // Bounds only approximate the shape, needs the exact test
+        FLAG_NO_OWNER = 1 << 1   // Never collides (collision tests require an owner)
+    };
+
+    std::vector<float> MinX;
+    std::vector<float> MinY;
+    std::vector<float> MaxX;
+    std::vector<float> MaxY;
+    std::vector<uint32_t> Flags;
+    std::vector<uint32_t> Category;
+    std::vector<uint32_t> Mask;
+
+    void Resize(size_t count);
+    size_t Size() const { return MinX.size(); }
+
+    void Set(uint32_t index, const AABB& bounds, uint32_t flags,
+             uint32_t category = COLLISION_ALL_LAYERS, uint32_t mask = COLLISION_ALL_LAYERS);
+    AABB Get(uint32_t index) const;
+};
+
+// Append the indices in [begin, end) whose box overlaps the query (touching counts)
+void OverlapRange(const BoundsSoA& bounds, const AABB& query, uint32_t begin, uint32_t end,
+                  std::vector<uint32_t>& outIndices);
+
+// Keep only the listed indices whose box overlaps the query and whose layers accept
+// the query's category/mask (ShouldCollide), in place and in order. Returns the number kept.
+size_t FilterOverlaps(const BoundsSoA& bounds, const AABB& query, uint32_t category, uint32_t mask,
+                      uint32_t* indices, size_t count);
+
+// Instruction set the kernels were compiled for ("AVX2", "AVX", "SSE2" or "Scalar")
+const char* GetOverlapKernelName();
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Physics/AABB.h"
+#include "Physics/BoundsSoA.h"
+#include <cstdint>
+#include <vector>
+
+class Collider;
+
+// Receives the colliders a ray may hit from Broadphase::Raycast
+class RaycastVisitor
+{
+public:
+    virtual ~RaycastVisitor() = default;
+
+    // Test collider 'index'. Return the ray's new max fraction (its closest hit so far)
+    // to clip the search, a negative value to ignore the candidate, or 0 to stop.
+    virtual float Visit(uint32_t index, float maxFraction) = 0;
+};
+
+enum class BroadphaseType
+{
+    BruteForce,    // Test every collider (reference path for comparisons)
+    SpatialHash,   // Uniform grid of hashed cells
+    SweepAndPrune, // Sorted interval endpoints, best when colliders move little
+    AABBTree       // Dynamic bounding volume hierarchy, also accelerates raycasts
+};
+
+// Finds colliders whose bounds may overlap a query box.
+// Results are indices into the collider list passed to Build.
+class Broadphase
+{
+public:
+    virtual ~Broadphase() = default;
+
+    // Rebuild from the current collider positions
+    virtual void Build(const std::vector<Collider*>& colliders) = 0;
+
+    // Append candidate indices (each at most once, in no particular order)
+    virtual void Query(const AABB& bounds, std::vector<uint32_t>& outIndices) const = 0;
+
+    // Candidates for collider 'index' of the last build (whose bounds are 'bounds').
+    // May omit the collider itself.
+    virtual void QueryCollider(uint32_t /*index*/, const AABB& bounds, std::vector<uint32_t>& outIndices) const
+    {
+        Query(bounds, outIndices);
+    }
+
+    // Feed the visitor every collider the segment start -> end may hit, shortening the
+    // segment as closer hits are reported. Candidates may repeat. Must not modify the
+    // broadphase, so several rays can be cast at once.
+    virtual void Raycast(const glm::vec2& start, const glm::vec2& end, RaycastVisitor& visitor) const;
+
+    virtual BroadphaseType GetType() const = 0;
+};
+
+// Checks the query box against every collider (with the SIMD overlap kernels)
+class BruteForceBroadphase : public Broadphase
+{
+public:
+    void Build(const std::vector<Collider*>& colliders) override;
+    void Query(const AABB& bounds, std::vector<uint32_t>& outIndices) const override;
+    BroadphaseType GetType() const override { return BroadphaseType::BruteForce; }
+
+private:
+    BoundsSoA m_Bounds;
+};
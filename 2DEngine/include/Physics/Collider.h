@@ -1,6 +1,15 @@
 #pragma once
 
 #include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Physics/AABB.h"
+#include "Physics/AlphaMask.h"
+#include "Physics/ColliderHandle.h"
+#include "Physics/CollisionFilter.h"
+#include "Physics/Raycast.h"
 
 // Forward declaration
 class Entity;
@@ -8,7 +17,16 @@ class Entity;
 enum class ColliderType
 {
     Box,    // AABB (Axis-Aligned Bounding Box)
-    Circle
+    Circle,
+    Mask    // Pixel-perfect, from a sprite's alpha
+};
+
+// How far two overlapping colliders interpenetrate: moving the second one by
+// Normal * Depth separates them
+struct Penetration
+{
+    glm::vec2 Normal = glm::vec2(0.0f, 1.0f);  // Unit, pointing from the first collider to the second
+    float Depth = 0.0f;
 };
 
 // Base collider class
@@ -21,6 +39,24 @@ public:
     // Check collision with another collider
     bool CheckCollision(const Collider* other) const;
 
+    // Same overlap test, also measuring how deep 'other' is in (for contact resolution)
+    bool GetPenetration(const Collider* other, Penetration& outPenetration) const;
+
+    // Intersect the segment start -> end, up to maxFraction along it. A segment starting
+    // inside hits at fraction 0. Fills everything in outHit except HitCollider.
+    bool Raycast(const glm::vec2& start, const glm::vec2& end, float maxFraction, RaycastHit& outHit) const;
+
+    // Move this collider's center from 'from' towards 'to' (up to maxFraction of the way)
+    // and find when it first touches 'other'. outHit.Point is this collider's center at
+    // that time and Normal is the surface normal of 'other'. Doesn't set HitCollider.
+    bool Sweep(const Collider* other, const glm::vec2& from, const glm::vec2& to, float maxFraction,
+               RaycastHit& outHit) const;
+
+    // Overlap tests against a region instead of another collider (touching counts, as in
+    // CheckCollision). Disabled colliders and colliders without an owner never overlap.
+    bool OverlapsBox(const AABB& box) const;
+    bool OverlapsCircle(const glm::vec2& center, float radius) const;
+
     // Get the collider's world position (entity position + offset)
     glm::vec2 GetWorldPosition() const;
 
@@ -28,6 +64,10 @@ public:
     void SetOffset(const glm::vec2& offset) { m_Offset = offset; }
     void SetEnabled(bool enabled) { m_Enabled = enabled; }
     void SetTrigger(bool isTrigger) { m_IsTrigger = isTrigger; }
+    void SetBullet(bool isBullet) { m_IsBullet = isBullet; }
+    void SetStatic(bool isStatic);  // See Physics::InvalidateStatic
+    void SetCategory(uint32_t category) { m_Category = category; }
+    void SetMask(uint32_t mask) { m_Mask = mask; }
 
     // Getters
     const glm::vec2& GetOffset() const { return m_Offset; }
@@ -35,6 +75,23 @@ public:
     Entity* GetOwner() const { return m_Owner; }
     bool IsEnabled() const { return m_Enabled; }
     bool IsTrigger() const { return m_IsTrigger; }
+    bool IsBullet() const { return m_IsBullet; }
+    bool IsStatic() const { return m_IsStatic; }
+    uint32_t GetCategory() const { return m_Category; }
+    uint32_t GetMask() const { return m_Mask; }
+
+    // Category/mask test only (see CollisionFilter.h), no geometry
+    bool CanCollideWith(const Collider* other) const
+    {
+        return ShouldCollide(m_Category, m_Mask, other->m_Category, other->m_Mask);
+    }
+
+    // Set while registered with Physics
+    ColliderHandle GetHandle() const { return m_Handle; }
+    bool IsRegistered() const { return !m_Handle.IsNull(); }
+
+    // World-space bounding box (used by the broadphase)
+    virtual AABB GetWorldBounds() const = 0;
 
     // Debug rendering
     virtual void DebugRender() const = 0;
@@ -45,6 +102,18 @@ protected:
     glm::vec2 m_Offset;  // Offset from entity position
     bool m_Enabled;
     bool m_IsTrigger;    // If true, doesn't block movement but still detects collision
+    bool m_IsBullet;     // If true, Physics::Step sweeps it between ticks so it can't tunnel
+    bool m_IsStatic;     // Never moves: kept in a broadphase that isn't rebuilt per tick
+    uint32_t m_Category; // Collision filtering bits
+    uint32_t m_Mask;
+
+private:
+    friend class Physics;
+
+    ColliderHandle m_Handle;
+    uint32_t m_PhysicsIndex;  // Position in Physics' collider list while registered
+    uint32_t m_PartitionIndex;  // Position in its static/dynamic partition
+    glm::vec2 m_SweepStart;   // World position at the last Physics::Step (bullets)
 };
 
 // Box collider (AABB)
@@ -60,6 +129,7 @@ public:
     glm::vec2 GetMin() const;
     glm::vec2 GetMax() const;
 
+    AABB GetWorldBounds() const override { return AABB(GetMin(), GetMax()); }
     void DebugRender() const override;
 
 private:
@@ -75,8 +145,46 @@ public:
     void SetRadius(float radius) { m_Radius = radius; }
     float GetRadius() const { return m_Radius; }
 
+    AABB GetWorldBounds() const override;
     void DebugRender() const override;
 
 private:
     float m_Radius;
+};
+
+// Pixel-perfect collider: a sprite's alpha mask stretched over a box of the given size,
+// the way the sprite is drawn. Overlaps only count where the mask has texels set.
+// Rigid body contacts treat it as its box once the texels overlap.
+class MaskCollider : public Collider
+{
+public:
+    MaskCollider(Entity* owner, const glm::vec2& size, std::shared_ptr<const AlphaMask> mask);
+
+    // Every frame of a sprite sheet with frameCount frames side by side, starting on frame 0
+    MaskCollider(Entity* owner, const glm::vec2& size, const std::string& texturePath, int frameCount = 1);
+
+    // Switch to another sprite sheet frame (keep in step with the sprite's animation)
+    void SetFrame(int frame);
+    int GetFrame() const { return m_Frame; }
+    int GetFrameCount() const { return (int)m_Frames.size(); }
+
+    void SetSize(const glm::vec2& size) { m_Size = size; }
+    const glm::vec2& GetSize() const { return m_Size; }
+
+    const AlphaMask& GetAlphaMask() const { return *m_Frames[m_Frame]; }
+
+    // World size of one mask texel
+    glm::vec2 GetTexelSize() const;
+
+    // Get min/max bounds in world space
+    glm::vec2 GetMin() const;
+    glm::vec2 GetMax() const;
+
+    AABB GetWorldBounds() const override { return AABB(GetMin(), GetMax()); }
+    void DebugRender() const override;
+
+private:
+    glm::vec2 m_Size;
+    std::vector<std::shared_ptr<const AlphaMask>> m_Frames;  // Never null
+    int m_Frame;
 };
\ No newline at end of file
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+// Refers to a registered collider. Cheap to copy and store; once the collider is
+// unregistered its slot's generation moves on and the handle no longer resolves.
+struct ColliderHandle
+{
+    static constexpr uint32_t INVALID_SLOT = 0xFFFFFFFF;
+
+    uint32_t Slot = INVALID_SLOT;
+    uint32_t Generation = 0;
+
+    bool IsNull() const { return Slot == INVALID_SLOT; }
+    bool operator==(const ColliderHandle& other) const { return Slot == other.Slot && Generation == other.Generation; }
+    bool operator!=(const ColliderHandle& other) const { return !(*this == other); }
+};
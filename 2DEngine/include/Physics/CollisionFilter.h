@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+// Collision filtering bits. Every collider has a category (what it is) and a mask
+// (what it wants to touch); two colliders interact only if each one's category is
+// in the other's mask. Games define their own named bits.
+constexpr uint32_t COLLISION_DEFAULT_CATEGORY = 1u << 0;
+constexpr uint32_t COLLISION_ALL_LAYERS = 0xFFFFFFFFu;
+
+inline bool ShouldCollide(uint32_t categoryA, uint32_t maskA, uint32_t categoryB, uint32_t maskB)
+{
+    return (categoryA & maskB) != 0 && (categoryB & maskA) != 0;
+}
@@ -0,0 +1,194 @@
+#pragma once
+
+#include "Physics/AABB.h"
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// Dynamic bounding volume hierarchy over "fat" AABBs (tight bounds grown by a margin,
+// so small movements don't touch the tree). Leaves are proxies; inserts pick the
+// cheapest sibling by perimeter and the tree is kept balanced with rotations.
+class DynamicAABBTree
+{
+public:
+    static constexpr int NULL_NODE = -1;
+
+    explicit DynamicAABBTree(float margin = 4.0f);
+
+    // Returns the proxy id
+    int CreateProxy(const AABB& bounds, uint32_t userData);
+    void DestroyProxy(int proxyId);
+
+    // Re-insert the proxy if its tight bounds left the fat AABB. The displacement
+    // (movement since last tick) stretches the fat box in the direction of travel.
+    // Returns true if the proxy was re-inserted.
+    bool MoveProxy(int proxyId, const AABB& bounds, const glm::vec2& displacement);
+
+    uint32_t GetUserData(int proxyId) const { return m_Nodes[proxyId].UserData; }
+    void SetUserData(int proxyId, uint32_t userData) { m_Nodes[proxyId].UserData = userData; }
+    const AABB& GetFatAABB(int proxyId) const { return m_Nodes[proxyId].Box; }
+
+    // Calls callback(proxyId) for every proxy whose fat AABB overlaps bounds.
+    // Return false from the callback to stop early.
+    template<typename Callback>
+    void Query(const AABB& bounds, Callback&& callback) const;
+
+    // Walks the proxies whose fat AABB the segment p1 -> p1 + maxFraction * (p2 - p1) crosses.
+    // callback(proxyId, maxFraction) returns: 0 to stop, < 0 to ignore the proxy,
+    // or a new (smaller) max fraction to clip the ray to a hit.
+    template<typename Callback>
+    void Raycast(const glm::vec2& p1, const glm::vec2& p2, float maxFraction, Callback&& callback) const;
+
+    void Clear();
+
+    int GetHeight() const { return m_Root == NULL_NODE ? 0 : m_Nodes[m_Root].Height; }
+    int GetProxyCount() const { return m_ProxyCount; }
+    float GetMargin() const { return m_Margin; }
+
+private:
+    struct Node
+    {
+        AABB Box;
+        int Parent = NULL_NODE;  // Next free node while on the free list
+        int Child1 = NULL_NODE;
+        int Child2 = NULL_NODE;
+        int Height = -1;         // Leaf = 0, free = -1
+        uint32_t UserData = 0;
+
+        bool IsLeaf() const { return Child1 == NULL_NODE; }
+    };
+
+    // Traversal stack that starts on the caller's stack and only spills to the heap
+    // for very deep trees (keeps queries allocation-free and safe across threads)
+    struct TraversalStack
+    {
+        int Local[128];
+        std::vector<int> Heap;
+        int Count = 0;
+
+        void Push(int node)
+        {
+            if (Count < 128) Local[Count] = node;
+            else Heap.push_back(node);
+            Count++;
+        }
+
+        int Pop()
+        {
+            Count--;
+            if (Count < 128) return Local[Count];
+            int node = Heap.back();
+            Heap.pop_back();
+            return node;
+        }
+
+        bool Empty() const { return Count == 0; }
+    };
+
+    struct SiblingCandidate
+    {
+        int Node;
+        float InheritedCost;  // Growth of the ancestors' boxes if the leaf goes below this node
+    };
+
+    int AllocateNode();
+    void FreeNode(int node);
+
+    int FindBestSibling(const AABB& leafBox);
+    void InsertLeaf(int leaf);
+    void RemoveLeaf(int leaf);
+    int Balance(int node);
+
+    std::vector<Node> m_Nodes;
+    std::vector<SiblingCandidate> m_SiblingStack;  // Reused by every insert
+    int m_Root;
+    int m_FreeList;
+    int m_ProxyCount;
+    float m_Margin;
+};
+
+// ============================================
+// Template implementations
+// ============================================
+
+template<typename Callback>
+void DynamicAABBTree::Query(const AABB& bounds, Callback&& callback) const
+{
+    TraversalStack stack;
+    stack.Push(m_Root);
+
+    while (!stack.Empty())
+    {
+        int nodeId = stack.Pop();
+        if (nodeId == NULL_NODE) continue;
+
+        const Node& node = m_Nodes[nodeId];
+        if (!node.Box.Overlaps(bounds)) continue;
+
+        if (node.IsLeaf())
+        {
+            if (!callback(nodeId))
+                return;
+        }
+        else
+        {
+            stack.Push(node.Child1);
+            stack.Push(node.Child2);
+        }
+    }
+}
+
+template<typename Callback>
+void DynamicAABBTree::Raycast(const glm::vec2& p1, const glm::vec2& p2, float maxFraction, Callback&& callback) const
+{
+    glm::vec2 d = p2 - p1;
+    float length = glm::length(d);
+
+    // Normal to the segment, for the separating axis test against each box
+    // (a zero-length segment is a point and only needs the box overlap)
+    glm::vec2 v(0.0f);
+    if (length > 0.0f)
+        v = glm::vec2(-d.y, d.x) / length;
+    glm::vec2 absV = glm::abs(v);
+
+    glm::vec2 t = p1 + maxFraction * d;
+    AABB segmentBox(glm::min(p1, t), glm::max(p1, t));
+
+    TraversalStack stack;
+    stack.Push(m_Root);
+
+    while (!stack.Empty())
+    {
+        int nodeId = stack.Pop();
+        if (nodeId == NULL_NODE) continue;
+
+        const Node& node = m_Nodes[nodeId];
+        if (!node.Box.Overlaps(segmentBox)) continue;
+
+        // |dot(v, p1 - c)| > dot(|v|, h): the box lies entirely on one side of the line
+        glm::vec2 c = node.Box.GetCenter();
+        glm::vec2 h = node.Box.GetSize() * 0.5f;
+        float separation = std::abs(glm::dot(v, p1 - c)) - glm::dot(absV, h);
+        if (separation > 0.0f) continue;
+
+        if (node.IsLeaf())
+        {
+            float value = callback(nodeId, maxFraction);
+            if (value == 0.0f)
+                return;
+
+            if (value > 0.0f && value < maxFraction)
+            {
+                // Clip the segment to the closer hit
+                maxFraction = value;
+                t = p1 + maxFraction * d;
+                segmentBox = AABB(glm::min(p1, t), glm::max(p1, t));
+            }
+        }
+        else
+        {
+            stack.Push(node.Child1);
+            stack.Push(node.Child2);
+        }
+    }
+}
@@ -2,38 +2,280 @@
 
 #include <vector>
 #include <memory>
+#include <functional>
 #include <glm/glm.hpp>  // Add this include
+#include "Physics/Broadphase.h"
+#include "Physics/Raycast.h"
+#include "Physics/ColliderHandle.h"
+#include "Physics/CollisionFilter.h"
 
 class Collider;
 class Entity;
+class RigidBody;
+
+struct PhysicsSettings
+{
+    BroadphaseType Broadphase = BroadphaseType::SpatialHash;  // Chosen at Physics::Init, switchable later
+    float CellSize = 64.0f;  // Spatial hash cell size in world units (~ typical collider size)
+    float TreeMargin = 4.0f; // AABB tree fat-box margin in world units
+
+    // Rigid bodies
+    glm::vec2 Gravity = glm::vec2(0.0f);  // World units per second squared
+    int VelocityIterations = 8;           // Contact solver passes per Step
+    float SleepSpeed = 2.0f;              // Bodies slower than this (units per second) ...
+    float TimeToSleep = 0.5f;             // ... for this many seconds, along with their island, sleep
+};
+
+// Return false to make a ray pass through the collider
+using RaycastFilter = std::function<bool(const Collider*)>;
 
 // Simple physics/collision manager
 class Physics
 {
 public:
-    static void Init();
+    static void Init(const PhysicsSettings& settings = PhysicsSettings());
     static void Shutdown();
 
-    // Register/unregister colliders
+    // Switch broadphase/cell size at runtime (e.g. to compare against brute force)
+    static void SetSettings(const PhysicsSettings& settings);
+    static const PhysicsSettings& GetSettings() { return s_Settings; }
+
+    // Start of a simulation tick: colliders may have moved, so the broadphase
+    // is rebuilt by the next query (once per tick, however many queries follow)
+    static void BeginFrame();
+
+    // End of a fixed tick: moves awake rigid bodies, finds every overlapping pair once,
+    // pushes bodies out of solid colliders and calls the owners' OnCollisionEnter/Stay/Exit,
+    // comparing against the previous tick's pairs.
+    // Bullet colliders are swept from where the last Step left them, so whatever
+    // they passed through in between also counts as a contact for this tick.
+    // Pairs between sleeping bodies (or a sleeping body and a static collider) aren't
+    // retested and keep their last state. Callbacks run in a fixed order (by collider
+    // registration slot) and may unregister or move colliders, but must not call Step.
+    static void Step(float fixedDeltaTime);
+
+    // Register/unregister colliders (both O(1); unregistering may reorder the list)
     static void RegisterCollider(Collider* collider);
     static void UnregisterCollider(Collider* collider);
 
+    // Same for rigid bodies (Entity::SetRigidBody does both)
+    static void RegisterBody(RigidBody* body);
+    static void UnregisterBody(RigidBody* body);
+
+    // Static colliders (Collider::SetStatic) are assumed not to change, and their
+    // broadphase is only rebuilt when one is added or removed. Call this after moving,
+    // resizing or re-layering one.
+    static void InvalidateStatic();
+
+    // The collider a handle refers to, or nullptr if it has since been unregistered
+    static Collider* GetCollider(ColliderHandle handle);
+    static bool IsValid(ColliderHandle handle) { return GetCollider(handle) != nullptr; }
+
     // Check collision for a specific collider
     static bool CheckCollision(const Collider* collider, Collider** outOther = nullptr);
 
     // Get all colliders colliding with this one
     static std::vector<Collider*> GetCollisions(const Collider* collider);
 
+    // Same, into a caller buffer: writes up to 'capacity' colliders (stopping once it's
+    // full) and returns how many were written. Doesn't allocate.
+    static size_t GetCollisions(const Collider* collider, Collider** outColliders, size_t capacity);
+
+    // Calls callback(Collider* other) for each collider colliding with this one, in
+    // collider list order; return false from the callback to stop early. Doesn't
+    // allocate. The callback must not run other Physics queries.
+    template<typename Callback>
+    static void ForEachCollision(const Collider* collider, Callback&& callback);
+
+    // Colliders overlapping a region (touching counts), among enabled colliders whose
+    // category is in layerMask, in collider list order. Write up to 'capacity' colliders
+    // (stopping once it's full) and return how many were written. The region needs no
+    // collider of its own, and nothing is allocated.
+    static size_t QueryAABB(const AABB& bounds, Collider** outColliders, size_t capacity,
+                            uint32_t layerMask = COLLISION_ALL_LAYERS);
+    static size_t QueryCircle(const glm::vec2& center, float radius, Collider** outColliders, size_t capacity,
+                              uint32_t layerMask = COLLISION_ALL_LAYERS);
+    static size_t QueryPoint(const glm::vec2& point, Collider** outColliders, size_t capacity,
+                             uint32_t layerMask = COLLISION_ALL_LAYERS);
+
     // Raycast (check if a line intersects any collider)
     static bool Raycast(const glm::vec2& start, const glm::vec2& end,
                        Collider** outHit = nullptr, glm::vec2* outPoint = nullptr);
 
-    // Debug rendering
+    // Nearest enabled collider hit by the segment start -> end, among colliders whose
+    // category is in layerMask (and that pass the filter)
+    static bool Raycast(const glm::vec2& start, const glm::vec2& end, RaycastHit& outHit,
+                        uint32_t layerMask = COLLISION_ALL_LAYERS, const RaycastFilter& filter = nullptr);
+
+    // One result per ray (HitCollider is nullptr on a miss), returns the number of hits.
+    // With parallel set, large batches are split over the JobSystem; the filter must then
+    // be safe to call from several threads, and colliders must not move until it returns.
+    static size_t RaycastMany(const std::vector<Ray>& rays, std::vector<RaycastHit>& outHits,
+                              bool parallel = false, uint32_t layerMask = COLLISION_ALL_LAYERS,
+                              const RaycastFilter& filter = nullptr);
+
+    // Continuous collision: move the collider's center from 'from' to 'to' and find the
+    // first collider (that the layers allow) it touches on the way. Fraction is the time
+    // of impact along the move, Point the collider's center at that time and Normal the
+    // hit surface's normal.
+    static bool Sweep(const Collider* collider, const glm::vec2& from, const glm::vec2& to,
+                      RaycastHit& outHit);
+
+    // Debug rendering (queues collider shapes with DebugDraw)
     static void DebugRenderColliders();
     static void SetDebugDraw(bool enabled) { s_DebugDraw = enabled; }
     static bool IsDebugDrawEnabled() { return s_DebugDraw; }
 
 private:
-    static std::vector<Collider*> s_Colliders;
+    friend class Collider;
+
+    // Colliders sharing one broadphase. Static colliders get their own, rebuilt only
+    // when that set changes; the dynamic one is rebuilt every tick.
+    struct Partition
+    {
+        std::unique_ptr<Broadphase> Phase;
+        std::vector<Collider*> Colliders;   // The broadphase's indices refer to this list
+        std::vector<uint32_t> GlobalIndex;  // Index into s_Colliders of each entry
+        bool Dirty = true;                  // Broadphase needs rebuilding
+    };
+
+    static Partition& GetPartition(const Collider* collider);
+    static void AddToPartition(Collider* collider);
+    static void RemoveFromPartition(Collider* collider);
+
+    static constexpr uint32_t NO_PARTITION_INDEX = 0xFFFFFFFFu;
+
+    // Append the partition's candidates for 'bounds' to s_Candidates, as indices into
+    // s_Colliders. selfIndex is the querying collider's index in this partition, or
+    // NO_PARTITION_INDEX if it isn't in it.
+    static void QueryPartition(const Partition& partition, const AABB& bounds, uint32_t selfIndex);
+
+    // Rebuild the broadphases if colliders moved or the set changed since the last build
+    static void SyncBroadphase();
+    static void SnapshotBounds(uint32_t index);
+
+    // Broadphase candidates whose bounds overlap the collider's and whose layers
+    // accept it, in collider list order
+    static void GatherCandidates(const Collider* collider);
+
+    // GatherCandidates for an enabled collider; false (and no candidates) otherwise
+    static bool BeginCollisionQuery(const Collider* collider);
+
+    // Exact test against candidate 'index', skipping it when the bounds already decide
+    static bool TestCandidate(const Collider* collider, uint32_t index);
+
+    // Calls callback(Collider*, uint32_t flags) for each enabled collider with an owner
+    // whose bounds overlap the region's and whose category is in layerMask, in collider
+    // list order, with its BoundsSoA flags; return false to stop early
+    template<typename Callback>
+    static void ForEachInRegion(const AABB& bounds, uint32_t layerMask, Callback&& callback);
+
+    // Raycast against the broadphase as last built (read-only, so rays can run concurrently)
+    static bool CastRay(const glm::vec2& start, const glm::vec2& end, RaycastHit& outHit,
+                        uint32_t layerMask, const RaycastFilter& filter);
+
+    // Forget every registration (colliders left registered become unregistered)
+    static void ClearColliders();
+
+    // Overlapping pair of colliders, lower slot first. Handles (not indices) so a pair
+    // keeps its key while other colliders come and go.
+    struct ContactPair
+    {
+        ColliderHandle A;
+        ColliderHandle B;
+
+        bool operator<(const ContactPair& other) const;
+        bool operator==(const ContactPair& other) const { return A == other.A && B == other.B; }
+    };
+
+    enum class ContactEvent { Enter, Stay, Exit };
+
+    // Every overlapping pair this tick plus each bullet's first swept hit, sorted
+    static void FindContacts(std::vector<ContactPair>& outPairs);
+
+    static ContactPair MakeContactPair(const Collider* a, const Collider* b);
+
+    // The collider's rigid body, if its owner has one
+    static RigidBody* GetBody(const Collider* collider);
+
+    // Static, or its body is asleep: pairs of these are skipped by the narrow phase
+    static bool IsResting(const Collider* collider);
+
+    // Solid contact between two colliders, at least one with an awake dynamic body
+    struct BodyContact
+    {
+        ContactPair Pair;
+        Collider* ColliderA;
+        Collider* ColliderB;
+        RigidBody* A;  // Either may be nullptr (an immovable collider)
+        RigidBody* B;
+        glm::vec2 Normal;  // From A to B
+        float NormalMass;
+        float Bias;         // Bounce-back speed along the normal
+        float Friction;
+        float NormalImpulse;  // Accumulated this Step, and the next one starts from it
+        float TangentImpulse;
+    };
+
+    static void IntegrateVelocities(float dt);
+    static void SolveVelocities(const std::vector<ContactPair>& pairs);
+    static void IntegratePositions(float dt);
+    static void SolvePositions();
+    static void UpdateSleep(const std::vector<ContactPair>& pairs, float dt);
+    static uint32_t FindIsland(uint32_t body);
+    static void WakeBodies(const ContactPair& pair);
+
+    // Broadphase output for the narrow phase: indices into s_Colliders, A < B
+    struct CandidatePair
+    {
+        uint32_t A;
+        uint32_t B;
+    };
+
+    // Call both owners' callback for the event (skipping sides that are gone)
+    static void DispatchContact(const ContactPair& pair, ContactEvent event);
+
+    struct ColliderSlot
+    {
+        Collider* Owner = nullptr;
+        uint32_t Generation = 1;  // Bumped on unregister, so old handles stop matching
+        uint32_t NextFree = ColliderHandle::INVALID_SLOT;
+    };
+
+    static std::vector<Collider*> s_Colliders;  // Dense, each collider knows its index
+    static std::vector<ColliderSlot> s_Slots;
+    static uint32_t s_FreeSlot;
     static bool s_DebugDraw;
-};
\ No newline at end of file
+
+    static PhysicsSettings s_Settings;
+    static Partition s_Dynamic;
+    static Partition s_Static;
+    static bool s_BoundsDirty;  // Indices changed, s_Bounds needs a full refresh
+    static std::vector<uint32_t> s_Candidates;
+    static BoundsSoA s_Bounds;  // Per collider, refreshed with the broadphase
+    static std::vector<ContactPair> s_Contacts;      // Pairs found by the last Step
+    static std::vector<ContactPair> s_NewContacts;   // Scratch for the next Step
+    static std::vector<CandidatePair> s_CandidatePairs;
+    static std::vector<std::vector<ContactPair>> s_ThreadContacts;  // Narrow phase output, per job thread
+    static std::vector<RigidBody*> s_Bodies;  // Dense, each body knows its index
+    static std::vector<BodyContact> s_BodyContacts;      // Sorted by pair
+    static std::vector<BodyContact> s_LastBodyContacts;  // Previous Step's, for warm starting
+    static std::vector<float> s_IslandSleepTime;  // Per island root, scratch for UpdateSleep
+    static std::vector<uint8_t> s_IslandAwake;
+};
+
+// ============================================
+// Template implementations
+// ============================================
+
+template<typename Callback>
+void Physics::ForEachCollision(const Collider* collider, Callback&& callback)
+{
+    if (!BeginCollisionQuery(collider)) return;
+
+    for (uint32_t index : s_Candidates)
+    {
+        if (TestCandidate(collider, index) && !callback(s_Colliders[index]))
+            return;
+    }
+}
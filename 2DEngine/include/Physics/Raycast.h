@@ -0,0 +1,20 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+class Collider;
+
+// Segment from Start to End (rays are finite)
+struct Ray
+{
+    glm::vec2 Start = glm::vec2(0.0f);
+    glm::vec2 End = glm::vec2(0.0f);
+};
+
+struct RaycastHit
+{
+    Collider* HitCollider = nullptr;      // nullptr = nothing hit
+    glm::vec2 Point = glm::vec2(0.0f);
+    glm::vec2 Normal = glm::vec2(0.0f);   // Surface normal at the hit, facing back along the ray
+    float Fraction = 1.0f;                // Distance along the segment, 0 = Start, 1 = End
+};
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstdint>
+
+class Entity;
+
+// Moves its owner by velocity and gravity in Physics::Step, and gets pushed out of
+// other solid (non-trigger) colliders. Needs a collider on the same entity to collide.
+// Linear motion only: colliders are axis aligned boxes and circles.
+class RigidBody
+{
+public:
+    RigidBody(Entity* owner, float mass = 1.0f);
+
+    // World units per second. Setting a nonzero velocity wakes the body.
+    void SetVelocity(const glm::vec2& velocity);
+    const glm::vec2& GetVelocity() const { return m_Velocity; }
+
+    // Instant change in momentum (wakes the body)
+    void ApplyImpulse(const glm::vec2& impulse);
+
+    // 0 = kinematic: moves by its velocity but contacts never push it
+    void SetMass(float mass);
+    float GetMass() const { return m_InverseMass > 0.0f ? 1.0f / m_InverseMass : 0.0f; }
+    float GetInverseMass() const { return m_InverseMass; }
+
+    void SetRestitution(float restitution) { m_Restitution = restitution; }  // 0 = no bounce, 1 = elastic
+    void SetFriction(float friction) { m_Friction = friction; }
+    void SetGravityScale(float scale) { m_GravityScale = scale; }
+    void SetLinearDamping(float damping) { m_LinearDamping = damping; }  // Per second
+
+    float GetRestitution() const { return m_Restitution; }
+    float GetFriction() const { return m_Friction; }
+    float GetGravityScale() const { return m_GravityScale; }
+    float GetLinearDamping() const { return m_LinearDamping; }
+
+    // Bodies that stay slow for a while fall asleep together with everything touching
+    // them, and skip integration and the narrow phase until something awake touches
+    // them. Moving one by hand (Entity::SetPosition) doesn't wake it: call WakeUp.
+    void WakeUp();
+    bool IsAwake() const { return m_Awake; }
+
+    void SetSleepingAllowed(bool allowed);
+    bool IsSleepingAllowed() const { return m_SleepingAllowed; }
+
+    Entity* GetOwner() const { return m_Owner; }
+    bool IsRegistered() const { return m_Registered; }
+
+private:
+    friend class Physics;
+
+    Entity* m_Owner;
+    glm::vec2 m_Velocity;
+    float m_InverseMass;
+    float m_Restitution;
+    float m_Friction;
+    float m_GravityScale;
+    float m_LinearDamping;
+
+    bool m_Awake;
+    bool m_SleepingAllowed;
+    float m_SleepTime;        // How long it's been below the sleep speed
+
+    bool m_Registered;
+    uint32_t m_PhysicsIndex;  // Position in Physics' body list while registered
+    uint32_t m_Island;        // Union-find parent while Physics builds islands
+};
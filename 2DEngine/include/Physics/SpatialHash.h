@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Physics/Broadphase.h"
+
+// Uniform grid broadphase. Each collider is bucketed into every cell its
+// world AABB touches; a query only visits the cells its own box touches.
+class SpatialHashBroadphase : public Broadphase
+{
+public:
+    explicit SpatialHashBroadphase(float cellSize);
+
+    void Build(const std::vector<Collider*>& colliders) override;
+    void Query(const AABB& bounds, std::vector<uint32_t>& outIndices) const override;
+    void Raycast(const glm::vec2& start, const glm::vec2& end, RaycastVisitor& visitor) const override;
+    BroadphaseType GetType() const override { return BroadphaseType::SpatialHash; }
+
+    void SetCellSize(float cellSize);
+    float GetCellSize() const { return m_CellSize; }
+
+private:
+    struct CellEntry
+    {
+        uint64_t Key;
+        uint32_t Index;
+    };
+
+    struct CellRange
+    {
+        uint32_t Begin;
+        uint32_t Count;
+    };
+
+    // Open addressing slot (Count == 0 = empty)
+    struct CellSlot
+    {
+        uint64_t Key = 0;
+        CellRange Range = { 0, 0 };
+    };
+
+    glm::ivec2 ToCell(const glm::vec2& position) const;
+
+    // The cell's run in m_Entries, or nullptr if the cell is empty
+    const CellRange* FindCell(uint64_t key) const;
+
+    float m_CellSize;
+    float m_InvCellSize;
+
+    std::vector<AABB> m_Bounds;               // Per collider, captured at build time
+    std::vector<CellEntry> m_Entries;         // Sorted by cell key
+    std::vector<CellSlot> m_Cells;            // Hash table, power of two size, rebuilt in place
+    std::vector<uint32_t> m_Oversized;        // Colliders covering too many cells, always tested
+
+    // De-duplicates colliders that span several queried cells
+    mutable std::vector<uint32_t> m_QueryStamp;
+    mutable uint32_t m_QueryCounter;
+};
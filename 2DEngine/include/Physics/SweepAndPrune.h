@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Physics/Broadphase.h"
+#include <unordered_map>
+
+// Sweep-and-prune broadphase. Keeps both axes' interval endpoints sorted and
+// re-sorts them each tick with insertion sort, which is close to linear when
+// colliders barely move. Overlapping pairs are tracked from the endpoint swaps.
+class SweepAndPruneBroadphase : public Broadphase
+{
+public:
+    SweepAndPruneBroadphase();
+
+    void Build(const std::vector<Collider*>& colliders) override;
+    void Query(const AABB& bounds, std::vector<uint32_t>& outIndices) const override;
+    void QueryCollider(uint32_t index, const AABB& bounds, std::vector<uint32_t>& outIndices) const override;
+    BroadphaseType GetType() const override { return BroadphaseType::SweepAndPrune; }
+
+    size_t GetPairCount() const { return m_PairCount; }
+
+private:
+    struct Proxy
+    {
+        Collider* Owner = nullptr;
+        AABB Bounds;
+        uint32_t ListIndex = 0;          // Index in the collider list of the last build
+        uint32_t Stamp = 0;              // Build that last saw this collider
+        std::vector<uint32_t> Overlaps;  // Proxies whose bounds overlap this one
+        uint32_t Endpoints[2][2] = {};   // Position of the min / max endpoint on each axis
+        bool Alive = false;
+    };
+
+    struct Endpoint
+    {
+        float Value;
+        uint32_t Proxy;
+        bool IsMax;
+
+        // At equal values mins sort first, so touching boxes count as overlapping
+        bool operator<(const Endpoint& other) const
+        {
+            return Value < other.Value || (Value == other.Value && !IsMax && other.IsMax);
+        }
+    };
+
+    static constexpr uint32_t REMOVED_PROXY = 0xFFFFFFFF;
+
+    uint32_t AddProxy(Collider* collider);
+    void RemoveProxy(uint32_t proxy);     // Marks its endpoints REMOVED_PROXY for CompactEndpoints
+    void CompactEndpoints();
+    void SortAxis(int axis);
+
+    void AddPair(uint32_t a, uint32_t b);
+    void RemovePair(uint32_t a, uint32_t b);
+
+    std::vector<Proxy> m_Proxies;
+    std::vector<uint32_t> m_FreeProxies;
+    std::unordered_map<const Collider*, uint32_t> m_ProxyOf;
+    std::vector<uint32_t> m_ProxyOfIndex;  // Collider list index -> proxy
+
+    std::vector<Endpoint> m_Endpoints[2];  // X and Y
+    float m_MaxWidth;                      // Widest proxy on X, bounds how far back Query looks
+    size_t m_PairCount;
+    uint32_t m_BuildStamp;
+};
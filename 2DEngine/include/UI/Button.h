@@ -3,6 +3,7 @@
 #include <glm/glm.hpp>
 #include <string>
 #include <functional>
+#include "Graphics/TextCache.h"
 
 class Camera;
 
@@ -21,7 +22,7 @@ public:
 
     // Appearance
     void SetColors(const glm::vec4& normal, const glm::vec4& hover, const glm::vec4& pressed);
-    void SetText(const std::string& text) { m_Text = text; }
+    void SetText(const std::string& text) { m_Text = text; m_TextMesh.reset(); }
 
     // Transform
     void SetPosition(const glm::vec2& pos) { m_Position = pos; }
@@ -39,6 +40,7 @@ private:
     glm::vec2 m_Position;
     glm::vec2 m_Size;
     std::string m_Text;
+    TextMeshHandle m_TextMesh;  // Caption mesh, rebuilt when the text or active font changes
 
     glm::vec4 m_ColorNormal;
     glm::vec4 m_ColorHover;
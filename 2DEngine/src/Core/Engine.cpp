@@ -2,10 +2,15 @@
 #include "Core/Game.h"
 #include "Core/Window.h"
 #include "Core/Time.h"
+#include "Core/JobSystem.h"
 #include "Graphics/Camera.h"
+#include "Graphics/DebugDraw.h"
 #include "Graphics/Renderer.h"
 #include "Graphics/TextRenderer.h"
+#include "Graphics/TextCache.h"
+#include "Graphics/TextLayout.h"
 #include "Audio/AudioManager.h"
+#include "Entities/ProjectileSystem.h"
 #include "Input/Input.h"
 #include "Physics/Physics.h"
 
@@ -62,9 +67,14 @@ void Engine::Init()
     Time::Init();
     Renderer::Init();
     TextRenderer::Init();
+    DebugDraw::Init();
+    TextLayoutCache::Init();
+    TextCache::Init();
     AudioManager::Init();
     Input::Init(m_Window->GetNativeWindow());
+    JobSystem::Init();
     Physics::Init();
+    ProjectileSystem::Init();
 
     // Create camera
     m_Camera = std::make_unique<Camera>(
@@ -120,24 +130,53 @@ void Engine::GameLoop()
         Time::AddToAccumulator(deltaTime);
         while (Time::GetAccumulator() >= Time::FixedDeltaTime())
         {
+            Physics::BeginFrame();
             m_CurrentGame->OnFixedUpdate(Time::FixedDeltaTime());
+            Physics::Step(Time::FixedDeltaTime());
             Time::ReduceAccumulator();
         }
 
         // Update game
+        Physics::BeginFrame();
         m_CurrentGame->OnUpdate(deltaTime);
 
+        // Drop cached text that has not been drawn for a while
+        TextLayoutCache::NewFrame();
+        TextCache::NewFrame();
+
+        // Queue collider shapes once; every camera pass draws the same overlay
+        Physics::DebugRenderColliders();
+
         // Render
         Renderer::Clear(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-        Renderer::BeginScene(m_Camera->GetViewProjectionMatrix());
 
-        m_CurrentGame->OnRender();
+        int fbWidth, fbHeight;
+        glfwGetFramebufferSize(m_Window->GetNativeWindow(), &fbWidth, &fbHeight);
 
-        Physics::DebugRenderColliders();
+        // One scene pass per active camera, each confined to its viewport
+        for (Camera* camera : m_CurrentGame->GetCameras())
+        {
+            if (!camera->IsActive()) continue;
+
+            const glm::vec4& rect = camera->GetViewportRect();
+            glViewport((int)(rect.x * fbWidth), (int)(rect.y * fbHeight),
+                       (int)(rect.z * fbWidth), (int)(rect.w * fbHeight));
 
-        Renderer::EndScene();
+            Renderer::BeginScene(camera->GetViewProjectionMatrix());
+
+            m_CurrentGame->OnRenderCamera(*camera);
+
+            // Overlay shapes from this frame, in one draw on top of the scene
+            DebugDraw::Render(camera->GetViewProjectionMatrix());
+
+            Renderer::EndScene();
+        }
+
+        glViewport(0, 0, fbWidth, fbHeight);
 
         glfwSwapBuffers(m_Window->GetNativeWindow());
+
+        DebugDraw::NewFrame();
     }
 }
 
@@ -145,8 +184,13 @@ void Engine::Shutdown()
 {
     m_Camera.reset();
 
+    ProjectileSystem::Shutdown();
     Physics::Shutdown();
+    JobSystem::Shutdown();
     AudioManager::Shutdown();
+    TextCache::Shutdown();
+    TextLayoutCache::Shutdown();
+    DebugDraw::Shutdown();
     TextRenderer::Shutdown();
     Renderer::Shutdown();
 
@@ -0,0 +1,155 @@
+#include "Core/JobSystem.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+uint32_t JobSystem::s_ThreadCount = 1;
+
+// Pool state lives here rather than in the header, to keep <thread>/<mutex> out of it
+struct JobBatch
+{
+    void (*Function)(void*, size_t, size_t, uint32_t) = nullptr;
+    void* Context = nullptr;
+    size_t Count = 0;
+    size_t Chunk = 1;
+    std::atomic<size_t> Next{ 0 };
+    uint64_t Id = 0;
+    uint32_t Joined = 0;  // Workers that picked this batch up
+    uint32_t Busy = 0;    // Threads still running chunks
+};
+
+static std::vector<std::thread> s_Workers;
+static std::mutex s_Mutex;
+static std::mutex s_SubmitMutex;  // One batch at a time
+static std::condition_variable s_WakeCondition;
+static std::condition_variable s_DoneCondition;
+static JobBatch s_Batch;
+static bool s_Quit = false;
+
+static thread_local bool t_InJob = false;
+static thread_local uint32_t t_JobThread = 0;  // Thread index of the job running on this thread
+
+void JobSystem::Init(uint32_t workerThreads)
+{
+    Shutdown();
+
+    if (workerThreads == 0)
+    {
+        uint32_t hardware = std::thread::hardware_concurrency();
+        workerThreads = hardware > 1 ? hardware - 1 : 0;
+    }
+
+    s_Quit = false;
+    s_ThreadCount = workerThreads + 1;
+
+    // Workers wait for the batch after the current one. The id isn't reset on
+    // Shutdown, so a fresh worker must not treat the last batch as new.
+    uint64_t currentBatch;
+    {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        currentBatch = s_Batch.Id;
+    }
+
+    s_Workers.reserve(workerThreads);
+    for (uint32_t i = 0; i < workerThreads; i++)
+        s_Workers.emplace_back(WorkerMain, i + 1, currentBatch);
+}
+
+void JobSystem::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        s_Quit = true;
+    }
+    s_WakeCondition.notify_all();
+
+    for (std::thread& worker : s_Workers)
+        worker.join();
+
+    s_Workers.clear();
+    s_ThreadCount = 1;
+}
+
+void JobSystem::RunChunks(uint32_t thread)
+{
+    t_InJob = true;
+    t_JobThread = thread;
+
+    for (;;)
+    {
+        size_t begin = s_Batch.Next.fetch_add(s_Batch.Chunk);
+        if (begin >= s_Batch.Count) break;
+
+        size_t end = std::min(begin + s_Batch.Chunk, s_Batch.Count);
+        s_Batch.Function(s_Batch.Context, begin, end, thread);
+    }
+
+    t_InJob = false;
+}
+
+void JobSystem::WorkerMain(uint32_t thread, uint64_t lastBatch)
+{
+    for (;;)
+    {
+        {
+            std::unique_lock<std::mutex> lock(s_Mutex);
+            s_WakeCondition.wait(lock, [&] { return s_Quit || s_Batch.Id != lastBatch; });
+            if (s_Quit) return;
+
+            lastBatch = s_Batch.Id;
+            s_Batch.Joined++;
+            s_Batch.Busy++;
+        }
+
+        RunChunks(thread);
+
+        {
+            std::lock_guard<std::mutex> lock(s_Mutex);
+            s_Batch.Busy--;
+        }
+        s_DoneCondition.notify_one();
+    }
+}
+
+void JobSystem::Dispatch(size_t count, size_t minChunk, JobFunction function, void* context)
+{
+    if (count == 0) return;
+    minChunk = std::max<size_t>(minChunk, 1);
+
+    if (s_Workers.empty() || t_InJob || count < minChunk * 2)
+    {
+        // Nested calls keep the enclosing job's index, which no other running chunk has
+        function(context, 0, count, t_InJob ? t_JobThread : 0);
+        return;
+    }
+
+    std::lock_guard<std::mutex> submit(s_SubmitMutex);
+
+    // A few chunks per thread, so threads that finish early can take more
+    size_t chunk = std::max(minChunk, (count + s_ThreadCount * 4 - 1) / (s_ThreadCount * 4));
+
+    {
+        std::lock_guard<std::mutex> lock(s_Mutex);
+        s_Batch.Function = function;
+        s_Batch.Context = context;
+        s_Batch.Count = count;
+        s_Batch.Chunk = chunk;
+        s_Batch.Next = 0;
+        s_Batch.Joined = 0;
+        s_Batch.Busy = 1;
+        s_Batch.Id++;
+    }
+    s_WakeCondition.notify_all();
+
+    RunChunks(0);
+
+    // Every worker must have picked the batch up (and finished), or a late one could
+    // still read it after we return and the next batch overwrites it
+    std::unique_lock<std::mutex> lock(s_Mutex);
+    s_Batch.Busy--;
+    s_DoneCondition.wait(lock, [] { return s_Batch.Busy == 0 && s_Batch.Joined == s_Workers.size(); });
+}
@@ -0,0 +1,29 @@
+#include "ECS/ECSEntity.h"
+#include "ECS/Systems.h"
+
+ECSEntity::ECSEntity(World& world, const std::string& name)
+    : Entity(name)
+    , m_World(world)
+{
+    Transform transform;
+    transform.Position = m_Position;
+    transform.Scale = m_Scale;
+    transform.Rotation = m_Rotation;
+
+    m_ID = m_World.Create(transform, EntityLink{ this });
+}
+
+ECSEntity::~ECSEntity()
+{
+    m_World.Destroy(m_ID);
+}
+
+void ECSEntity::Render()
+{
+    if (!m_Active) return;
+
+    Transform* transform = m_World.Get<Transform>(m_ID);
+    Sprite* sprite = m_World.Get<Sprite>(m_ID);
+    if (transform && sprite)
+        SpriteRenderSystem::Draw(*transform, *sprite);
+}
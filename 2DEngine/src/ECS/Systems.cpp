@@ -0,0 +1,55 @@
+#include "ECS/Systems.h"
+#include "ECS/Components.h"
+#include "ECS/World.h"
+#include "Entities/Entity.h"
+#include "Graphics/Renderer.h"
+
+void TransformSystem::Update(World& world, float deltaTime)
+{
+    world.EachChunk<Transform, Velocity>([deltaTime](uint32_t count, const EntityID*, Transform* transforms,
+                                                     Velocity* velocities)
+    {
+        for (uint32_t i = 0; i < count; i++)
+            transforms[i].Position += velocities[i].Value * deltaTime;
+    });
+}
+
+void SpriteRenderSystem::Draw(const Transform& transform, const Sprite& sprite)
+{
+    if (!sprite.Visible) return;
+
+    glm::vec2 size = sprite.Size * transform.Scale;
+    bool fullTexture = sprite.TexCoords == glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+
+    // The sprite sheet path has no rotation, so only whole textures and solid quads turn
+    if (fullTexture)
+        Renderer::DrawQuad(Quad(transform.Position, size, sprite.Color, transform.Rotation, sprite.Image));
+    else
+        Renderer::DrawQuadWithTexCoords(transform.Position, size, sprite.Image, sprite.TexCoords, sprite.Color);
+}
+
+void SpriteRenderSystem::Render(World& world)
+{
+    world.EachChunk<Transform, Sprite>([](uint32_t count, const EntityID*, Transform* transforms, Sprite* sprites)
+    {
+        for (uint32_t i = 0; i < count; i++)
+            Draw(transforms[i], sprites[i]);
+    });
+}
+
+void ColliderSyncSystem::Update(World& world)
+{
+    world.EachChunk<Transform, EntityLink>([](uint32_t count, const EntityID*, Transform* transforms,
+                                              EntityLink* links)
+    {
+        for (uint32_t i = 0; i < count; i++)
+        {
+            Entity* object = links[i].Object;
+            if (!object) continue;
+
+            object->SetPosition(transforms[i].Position);
+            object->SetRotation(transforms[i].Rotation);
+            object->SetScale(transforms[i].Scale);
+        }
+    });
+}
@@ -0,0 +1,322 @@
+#include "ECS/World.h"
+
+#include <algorithm>
+
+static size_t AlignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) & ~(alignment - 1);
+}
+
+World::World()
+{
+    // The archetype with no components, so an entity always has one
+    GetArchetype(0);
+}
+
+World::~World() = default;
+
+// ============================================
+// Component Types
+// ============================================
+
+std::vector<World::ComponentInfo>& World::GetComponentInfos()
+{
+    static std::vector<ComponentInfo> s_Infos;
+    return s_Infos;
+}
+
+uint32_t World::RegisterComponentType(size_t size, size_t alignment)
+{
+    std::vector<ComponentInfo>& infos = GetComponentInfos();
+    assert(infos.size() < MAX_COMPONENT_TYPES && "Too many component types");
+
+    infos.push_back({ size, alignment });
+    return (uint32_t)infos.size() - 1;
+}
+
+// ============================================
+// Archetypes
+// ============================================
+
+World::Archetype* World::GetArchetype(ComponentMask mask)
+{
+    auto it = m_ArchetypesByMask.find(mask);
+    if (it != m_ArchetypesByMask.end()) return it->second;
+
+    auto archetype = std::make_unique<Archetype>();
+    archetype->Mask = mask;
+    archetype->Offsets.fill(0);
+    archetype->AddEdges.fill(nullptr);
+    archetype->RemoveEdges.fill(nullptr);
+
+    const std::vector<ComponentInfo>& infos = GetComponentInfos();
+    size_t rowBytes = sizeof(EntityID);
+    size_t padding = 0;
+    for (uint32_t type = 0; type < MAX_COMPONENT_TYPES; type++)
+    {
+        if (!((mask >> type) & 1)) continue;
+        archetype->Types.push_back(type);
+        rowBytes += infos[type].Size;
+        padding += infos[type].Alignment - 1;
+    }
+
+    // Entity ids first, then one array per component, each aligned for its type
+    uint32_t capacity = (uint32_t)((CHUNK_BYTES - padding) / rowBytes);
+    size_t offset = (size_t)capacity * sizeof(EntityID);
+    for (uint32_t type : archetype->Types)
+    {
+        offset = AlignUp(offset, infos[type].Alignment);
+        archetype->Offsets[type] = (uint32_t)offset;
+        offset += (size_t)capacity * infos[type].Size;
+    }
+    archetype->ChunkCapacity = capacity;
+
+    Archetype* result = archetype.get();
+    m_Archetypes.push_back(std::move(archetype));
+    m_ArchetypesByMask[mask] = result;
+
+    // Queries already cached pick up the new archetype
+    for (auto& [queryMask, matching] : m_Queries)
+    {
+        if ((mask & queryMask) == queryMask)
+            matching.push_back(result);
+    }
+
+    return result;
+}
+
+const std::vector<World::Archetype*>& World::GetMatching(ComponentMask mask)
+{
+    auto it = m_Queries.find(mask);
+    if (it != m_Queries.end()) return it->second;
+
+    std::vector<Archetype*>& matching = m_Queries[mask];
+    for (auto& archetype : m_Archetypes)
+    {
+        if ((archetype->Mask & mask) == mask)
+            matching.push_back(archetype.get());
+    }
+    return matching;
+}
+
+// ============================================
+// Rows
+// ============================================
+
+void World::AllocateRow(Archetype* archetype, EntityID entity, uint32_t& outChunk, uint32_t& outRow)
+{
+    if (archetype->UsedChunks == 0 ||
+        archetype->Chunks[archetype->UsedChunks - 1]->Count == archetype->ChunkCapacity)
+    {
+        if (archetype->UsedChunks == archetype->Chunks.size())
+            archetype->Chunks.push_back(std::make_unique<Chunk>());
+        archetype->UsedChunks++;
+    }
+
+    outChunk = archetype->UsedChunks - 1;
+    Chunk& chunk = *archetype->Chunks[outChunk];
+    outRow = chunk.Count++;
+    archetype->GetEntities(chunk)[outRow] = entity;
+}
+
+void World::FreeRow(Archetype* archetype, uint32_t chunkIndex, uint32_t row)
+{
+    // Fill the hole with the archetype's last row so chunks stay packed
+    uint32_t lastChunkIndex = archetype->UsedChunks - 1;
+    Chunk& chunk = *archetype->Chunks[chunkIndex];
+    Chunk& lastChunk = *archetype->Chunks[lastChunkIndex];
+    uint32_t lastRow = lastChunk.Count - 1;
+
+    if (chunkIndex != lastChunkIndex || row != lastRow)
+    {
+        EntityID moved = archetype->GetEntities(lastChunk)[lastRow];
+        archetype->GetEntities(chunk)[row] = moved;
+
+        const std::vector<ComponentInfo>& infos = GetComponentInfos();
+        for (uint32_t type : archetype->Types)
+        {
+            size_t size = infos[type].Size;
+            std::memcpy(static_cast<uint8_t*>(archetype->GetColumn(chunk, type)) + row * size,
+                        static_cast<uint8_t*>(archetype->GetColumn(lastChunk, type)) + lastRow * size, size);
+        }
+
+        EntityRecord& record = m_Records[moved.Index];
+        record.Chunk = chunkIndex;
+        record.Row = row;
+    }
+
+    if (--lastChunk.Count == 0)
+        archetype->UsedChunks--;
+}
+
+void World::MoveEntity(EntityID entity, Archetype* target)
+{
+    EntityRecord& record = m_Records[entity.Index];
+    Archetype* source = record.Owner;
+
+    uint32_t chunkIndex, row;
+    AllocateRow(target, entity, chunkIndex, row);
+
+    // Carry over the components both archetypes have; new ones are filled by the caller
+    Chunk& from = *source->Chunks[record.Chunk];
+    Chunk& to = *target->Chunks[chunkIndex];
+    const std::vector<ComponentInfo>& infos = GetComponentInfos();
+    for (uint32_t type : source->Types)
+    {
+        if (!target->Has(type)) continue;
+        size_t size = infos[type].Size;
+        std::memcpy(static_cast<uint8_t*>(target->GetColumn(to, type)) + row * size,
+                    static_cast<uint8_t*>(source->GetColumn(from, type)) + record.Row * size, size);
+    }
+
+    FreeRow(source, record.Chunk, record.Row);
+
+    record.Owner = target;
+    record.Chunk = chunkIndex;
+    record.Row = row;
+}
+
+// ============================================
+// Entities
+// ============================================
+
+EntityID World::CreateEntity(ComponentMask mask)
+{
+    assert(m_Iterating == 0 && "Entity created during a query");
+
+    EntityID entity;
+    if (!m_FreeIndices.empty())
+    {
+        entity.Index = m_FreeIndices.back();
+        m_FreeIndices.pop_back();
+    }
+    else
+    {
+        entity.Index = (uint32_t)m_Records.size();
+        m_Records.emplace_back();
+    }
+
+    EntityRecord& record = m_Records[entity.Index];
+    entity.Generation = record.Generation;
+
+    record.Owner = GetArchetype(mask);
+    AllocateRow(record.Owner, entity, record.Chunk, record.Row);
+
+    m_EntityCount++;
+    return entity;
+}
+
+void World::Destroy(EntityID entity)
+{
+    assert(m_Iterating == 0 && "Entity destroyed during a query, use DeferDestroy");
+    if (!IsAlive(entity)) return;
+
+    EntityRecord& record = m_Records[entity.Index];
+    FreeRow(record.Owner, record.Chunk, record.Row);
+
+    record.Owner = nullptr;
+    record.Generation++;
+    m_FreeIndices.push_back(entity.Index);
+    m_EntityCount--;
+}
+
+bool World::IsAlive(EntityID entity) const
+{
+    return GetRecord(entity) != nullptr;
+}
+
+void World::FlushDeferred()
+{
+    // Destroying an entity twice is harmless, IsAlive catches the second
+    for (EntityID entity : m_DeferredDestroys)
+        Destroy(entity);
+    m_DeferredDestroys.clear();
+}
+
+void World::Clear()
+{
+    assert(m_Iterating == 0 && "World cleared during a query");
+
+    for (uint32_t index = 0; index < (uint32_t)m_Records.size(); index++)
+    {
+        EntityRecord& record = m_Records[index];
+        if (!record.Owner) continue;
+
+        record.Owner = nullptr;
+        record.Generation++;
+        m_FreeIndices.push_back(index);
+    }
+
+    for (auto& archetype : m_Archetypes)
+    {
+        for (uint32_t i = 0; i < archetype->UsedChunks; i++)
+            archetype->Chunks[i]->Count = 0;
+        archetype->UsedChunks = 0;
+    }
+
+    m_DeferredDestroys.clear();
+    m_EntityCount = 0;
+}
+
+const World::EntityRecord* World::GetRecord(EntityID entity) const
+{
+    if (entity.Index >= m_Records.size()) return nullptr;
+
+    const EntityRecord& record = m_Records[entity.Index];
+    if (!record.Owner || record.Generation != entity.Generation) return nullptr;
+    return &record;
+}
+
+// ============================================
+// Components
+// ============================================
+
+void* World::GetComponent(EntityID entity, uint32_t type) const
+{
+    const EntityRecord* record = GetRecord(entity);
+    if (!record || !record->Owner->Has(type)) return nullptr;
+
+    Chunk& chunk = *record->Owner->Chunks[record->Chunk];
+    return static_cast<uint8_t*>(record->Owner->GetColumn(chunk, type)) + record->Row * GetComponentInfos()[type].Size;
+}
+
+void* World::AddComponent(EntityID entity, uint32_t type)
+{
+    const EntityRecord* record = GetRecord(entity);
+    if (!record) return nullptr;
+
+    Archetype* source = record->Owner;
+    if (!source->Has(type))
+    {
+        assert(m_Iterating == 0 && "Component added during a query");
+
+        Archetype* target = source->AddEdges[type];
+        if (!target)
+        {
+            target = GetArchetype(source->Mask | (ComponentMask(1) << type));
+            source->AddEdges[type] = target;
+            target->RemoveEdges[type] = source;
+        }
+        MoveEntity(entity, target);
+    }
+
+    return GetComponent(entity, type);
+}
+
+void World::RemoveComponent(EntityID entity, uint32_t type)
+{
+    const EntityRecord* record = GetRecord(entity);
+    if (!record || !record->Owner->Has(type)) return;
+
+    assert(m_Iterating == 0 && "Component removed during a query");
+
+    Archetype* source = record->Owner;
+    Archetype* target = source->RemoveEdges[type];
+    if (!target)
+    {
+        target = GetArchetype(source->Mask & ~(ComponentMask(1) << type));
+        source->RemoveEdges[type] = target;
+        target->AddEdges[type] = source;
+    }
+    MoveEntity(entity, target);
+}
@@ -13,6 +13,7 @@ Bullet::Bullet(const glm::vec2& position, const glm::vec2& direction, float spee
     , m_Alive(true)
 {
     m_Position = position;
+    m_PrevPos = position;
     
     // Add collider
     auto collider = std::make_unique<BoxCollider>(this, m_Size);
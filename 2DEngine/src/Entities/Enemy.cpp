@@ -134,4 +134,8 @@ void Enemy::SetAnimationFrame(int frame)
             m_Texture = m_AnimFrame2;
         }
     }
+
+    // Keep a pixel-perfect collider on the frame being drawn
+    if (m_Collider && m_Collider->GetType() == ColliderType::Mask)
+        static_cast<MaskCollider*>(m_Collider.get())->SetFrame(frame);
 }
\ No newline at end of file
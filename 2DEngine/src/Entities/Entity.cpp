@@ -1,6 +1,7 @@
 #include "Entities/Entity.h"
 #include "Physics/Collider.h"
 #include "Physics/Physics.h"
+#include "Physics/RigidBody.h"
 
 Entity::Entity(const std::string& name)
     : m_Name(name)
@@ -9,6 +10,7 @@ Entity::Entity(const std::string& name)
     , m_Rotation(0.0f)
     , m_Active(true)
     , m_Collider(nullptr)
+    , m_RigidBody(nullptr)
 {
 }
 
@@ -18,6 +20,11 @@ Entity::~Entity()
     {
         Physics::UnregisterCollider(m_Collider.get());
     }
+
+    if (m_RigidBody)
+    {
+        Physics::UnregisterBody(m_RigidBody.get());
+    }
 }
 
 void Entity::SetCollider(std::unique_ptr<Collider> collider)
@@ -36,4 +43,19 @@ void Entity::SetCollider(std::unique_ptr<Collider> collider)
     {
         Physics::RegisterCollider(m_Collider.get());
     }
-}
\ No newline at end of file
+}
+
+void Entity::SetRigidBody(std::unique_ptr<RigidBody> body)
+{
+    if (m_RigidBody)
+    {
+        Physics::UnregisterBody(m_RigidBody.get());
+    }
+
+    m_RigidBody = std::move(body);
+
+    if (m_RigidBody)
+    {
+        Physics::RegisterBody(m_RigidBody.get());
+    }
+}
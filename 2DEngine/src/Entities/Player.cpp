@@ -4,11 +4,11 @@
 #include "Graphics/Renderer.h"
 #include "Graphics/Texture.h"
 #include "Input/Input.h"
+#include "Physics/RigidBody.h"
 #include <glm/gtx/norm.hpp>
 
 Player::Player()
     : Entity("Player")
-    , m_Velocity(0.0f, 0.0f)
     , m_MaxSpeed(600.0f)
     , m_Acceleration(3000.0f)
     , m_Deceleration(3000.0f)
@@ -16,6 +16,11 @@ Player::Player()
     , m_Size(50.0f, 50.0f)
     , m_Texture(nullptr)
 {
+    // Steered directly, so it shouldn't fall asleep between key presses
+    auto body = std::make_unique<RigidBody>(this);
+    body->SetGravityScale(0.0f);
+    body->SetSleepingAllowed(false);
+    SetRigidBody(std::move(body));
 }
 
 Player::~Player()
@@ -27,8 +32,20 @@ void Player::SetTexture(const std::string& path)
     m_Texture = std::make_unique<Texture>(path);
 }
 
+const glm::vec2& Player::GetVelocity() const
+{
+    return m_RigidBody->GetVelocity();
+}
+
+void Player::Stop()
+{
+    m_RigidBody->SetVelocity(glm::vec2(0.0f));
+}
+
 void Player::Update(float deltaTime)
 {
+    glm::vec2 velocity = m_RigidBody->GetVelocity();
+
     // Get input direction
     glm::vec2 inputDir(0.0f);
 
@@ -51,36 +68,36 @@ void Player::Update(float deltaTime)
     // Apply acceleration or deceleration
     if (inputLength2 > 0.0f)
     {
-        m_Velocity += inputDir * m_Acceleration * deltaTime;
+        velocity += inputDir * m_Acceleration * deltaTime;
     }
     else
     {
-        float currentSpeed = glm::length(m_Velocity);
+        float currentSpeed = glm::length(velocity);
         if (currentSpeed > 0.0f)
         {
             float decelerationAmount = m_Deceleration * deltaTime;
 
             if (decelerationAmount >= currentSpeed)
             {
-                m_Velocity = glm::vec2(0.0f);
+                velocity = glm::vec2(0.0f);
             }
             else
             {
-                glm::vec2 velocityDir = m_Velocity / currentSpeed;
-                m_Velocity -= velocityDir * decelerationAmount;
+                glm::vec2 velocityDir = velocity / currentSpeed;
+                velocity -= velocityDir * decelerationAmount;
             }
         }
     }
 
     // Clamp velocity to max speed
-    float currentSpeed = glm::length(m_Velocity);
+    float currentSpeed = glm::length(velocity);
     if (currentSpeed > m_MaxSpeed)
     {
-        m_Velocity = (m_Velocity / currentSpeed) * m_MaxSpeed;
+        velocity = (velocity / currentSpeed) * m_MaxSpeed;
     }
 
-    // Apply velocity to position
-    m_Position += m_Velocity * deltaTime;
+    // Physics::Step integrates it in the fixed tick
+    m_RigidBody->SetVelocity(velocity);
 }
 
 
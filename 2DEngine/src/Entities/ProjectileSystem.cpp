@@ -0,0 +1,358 @@
+#include "Entities/ProjectileSystem.h"
+#include "Entities/Entity.h"
+#include "Graphics/Renderer.h"
+#include "Graphics/Shader.h"
+#include "Physics/Collider.h"
+#include "Physics/Physics.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+// Same SSE2 detection as the physics overlap kernels (BoundsSoA.cpp)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define PROJECTILE_SIMD_SSE 1
+    #include <emmintrin.h>
+#endif
+
+struct ProjectileSystem::ProjectileData
+{
+    uint32_t Capacity = 0;
+    uint32_t Count = 0;  // Projectiles [0, Count) are alive, packed
+
+    std::vector<float> PositionX;
+    std::vector<float> PositionY;
+    std::vector<float> PrevX;
+    std::vector<float> PrevY;
+    std::vector<float> VelocityX;
+    std::vector<float> VelocityY;
+    std::vector<float> Lifetime;  // Seconds left
+    std::vector<float> SizeX;
+    std::vector<float> SizeY;
+    std::vector<glm::vec4> Color;
+    std::vector<uint32_t> Category;
+    std::vector<uint32_t> Mask;
+
+    // Handles stay put while projectiles move around the packed arrays
+    std::vector<uint32_t> SlotOfIndex;
+    std::vector<uint32_t> IndexOfSlot;
+    std::vector<uint32_t> Generation;
+    std::vector<uint32_t> FreeSlots;
+
+    std::vector<uint32_t> Expired;  // Scratch for Update, ascending
+
+    // One box collider (never registered) that takes each projectile's shape in turn
+    // for Physics::Sweep; colliders need an owner to collide
+    Entity ProbeOwner;
+    std::unique_ptr<BoxCollider> Probe;
+
+    // Instanced quad: corner attribute per vertex, the packed arrays per instance
+    unsigned int VAO = 0;
+    unsigned int QuadVBO = 0;
+    unsigned int InstanceVBO = 0;
+    std::unique_ptr<Shader> ProjectileShader;
+    int ViewProjectionLocation = -1;  // Looked up once, so Render doesn't build a uniform name string
+    bool Uploaded = false;  // Instance buffer matches the arrays
+};
+
+std::unique_ptr<ProjectileSystem::ProjectileData> ProjectileSystem::s_Data = nullptr;
+
+void ProjectileSystem::Init(uint32_t capacity)
+{
+    s_Data = std::make_unique<ProjectileData>();
+    ProjectileData& d = *s_Data;
+    d.Capacity = capacity;
+
+    d.PositionX.resize(capacity);
+    d.PositionY.resize(capacity);
+    d.PrevX.resize(capacity);
+    d.PrevY.resize(capacity);
+    d.VelocityX.resize(capacity);
+    d.VelocityY.resize(capacity);
+    d.Lifetime.resize(capacity);
+    d.SizeX.resize(capacity);
+    d.SizeY.resize(capacity);
+    d.Color.resize(capacity);
+    d.Category.resize(capacity);
+    d.Mask.resize(capacity);
+
+    d.SlotOfIndex.resize(capacity);
+    d.IndexOfSlot.resize(capacity);
+    d.Generation.assign(capacity, 0);
+    d.FreeSlots.resize(capacity);
+    for (uint32_t i = 0; i < capacity; i++)
+        d.FreeSlots[i] = capacity - 1 - i;  // Hand out slot 0 first
+
+    d.Expired.reserve(capacity);
+
+    d.Probe = std::make_unique<BoxCollider>(&d.ProbeOwner, glm::vec2(1.0f));
+    d.Probe->SetTrigger(true);
+    d.Probe->SetBullet(true);
+
+    // Unit quad around the origin, scaled and moved per instance in the shader
+    const float corners[] = {
+        -0.5f, -0.5f,   0.5f, -0.5f,   0.5f, 0.5f,
+         0.5f,  0.5f,  -0.5f,  0.5f,  -0.5f, -0.5f
+    };
+
+    glGenVertexArrays(1, &d.VAO);
+    glGenBuffers(1, &d.QuadVBO);
+    glGenBuffers(1, &d.InstanceVBO);
+
+    glBindVertexArray(d.VAO);
+
+    glBindBuffer(GL_ARRAY_BUFFER, d.QuadVBO);
+    glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), (void*)0);
+
+    // The instance buffer holds PositionX, PositionY, SizeX, SizeY and Color back to back,
+    // each with room for the whole pool
+    size_t floats = (size_t)capacity * sizeof(float);
+    glBindBuffer(GL_ARRAY_BUFFER, d.InstanceVBO);
+    glBufferData(GL_ARRAY_BUFFER, floats * 4 + (size_t)capacity * sizeof(glm::vec4), nullptr, GL_STREAM_DRAW);
+
+    for (unsigned int attribute = 1; attribute <= 4; attribute++)
+    {
+        glEnableVertexAttribArray(attribute);
+        glVertexAttribPointer(attribute, 1, GL_FLOAT, GL_FALSE, sizeof(float), (void*)(floats * (attribute - 1)));
+        glVertexAttribDivisor(attribute, 1);
+    }
+    glEnableVertexAttribArray(5);
+    glVertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, sizeof(glm::vec4), (void*)(floats * 4));
+    glVertexAttribDivisor(5, 1);
+
+    glBindVertexArray(0);
+
+    d.ProjectileShader = std::make_unique<Shader>(
+        "assets/shaders/projectile.vert",
+        "assets/shaders/projectile.frag"
+    );
+    d.ViewProjectionLocation = glGetUniformLocation(d.ProjectileShader->GetID(), "u_ViewProjection");
+
+    std::cout << "ProjectileSystem initialized (" << capacity << " projectiles)\n";
+}
+
+void ProjectileSystem::Shutdown()
+{
+    if (s_Data)
+    {
+        glDeleteVertexArrays(1, &s_Data->VAO);
+        glDeleteBuffers(1, &s_Data->QuadVBO);
+        glDeleteBuffers(1, &s_Data->InstanceVBO);
+        s_Data.reset();
+    }
+}
+
+ProjectileHandle ProjectileSystem::Spawn(const ProjectileDesc& desc)
+{
+    if (!s_Data || s_Data->FreeSlots.empty()) return ProjectileHandle();
+
+    ProjectileData& d = *s_Data;
+    uint32_t slot = d.FreeSlots.back();
+    d.FreeSlots.pop_back();
+
+    uint32_t i = d.Count++;
+    d.PositionX[i] = desc.Position.x;
+    d.PositionY[i] = desc.Position.y;
+    d.PrevX[i] = desc.Position.x;
+    d.PrevY[i] = desc.Position.y;
+    d.VelocityX[i] = desc.Velocity.x;
+    d.VelocityY[i] = desc.Velocity.y;
+    d.Lifetime[i] = desc.Lifetime;
+    d.SizeX[i] = desc.Size.x;
+    d.SizeY[i] = desc.Size.y;
+    d.Color[i] = desc.Color;
+    d.Category[i] = desc.Category;
+    d.Mask[i] = desc.Mask;
+
+    d.SlotOfIndex[i] = slot;
+    d.IndexOfSlot[slot] = i;
+    d.Uploaded = false;
+
+    ProjectileHandle handle;
+    handle.Slot = slot;
+    handle.Generation = d.Generation[slot];
+    return handle;
+}
+
+void ProjectileSystem::RemoveAt(uint32_t index)
+{
+    // Move the last projectile into the hole so the arrays stay packed
+    ProjectileData& d = *s_Data;
+    uint32_t last = --d.Count;
+    uint32_t slot = d.SlotOfIndex[index];
+
+    if (index != last)
+    {
+        d.PositionX[index] = d.PositionX[last];
+        d.PositionY[index] = d.PositionY[last];
+        d.PrevX[index] = d.PrevX[last];
+        d.PrevY[index] = d.PrevY[last];
+        d.VelocityX[index] = d.VelocityX[last];
+        d.VelocityY[index] = d.VelocityY[last];
+        d.Lifetime[index] = d.Lifetime[last];
+        d.SizeX[index] = d.SizeX[last];
+        d.SizeY[index] = d.SizeY[last];
+        d.Color[index] = d.Color[last];
+        d.Category[index] = d.Category[last];
+        d.Mask[index] = d.Mask[last];
+
+        d.SlotOfIndex[index] = d.SlotOfIndex[last];
+        d.IndexOfSlot[d.SlotOfIndex[index]] = index;
+    }
+
+    d.Generation[slot]++;
+    d.FreeSlots.push_back(slot);
+    d.Uploaded = false;
+}
+
+bool ProjectileSystem::IsAlive(ProjectileHandle projectile)
+{
+    if (!s_Data || projectile.Slot >= s_Data->Capacity) return false;
+    if (s_Data->Generation[projectile.Slot] != projectile.Generation) return false;
+
+    // Free slots have an index that no longer points back at them
+    uint32_t index = s_Data->IndexOfSlot[projectile.Slot];
+    return index < s_Data->Count && s_Data->SlotOfIndex[index] == projectile.Slot;
+}
+
+void ProjectileSystem::Kill(ProjectileHandle projectile)
+{
+    if (!IsAlive(projectile)) return;
+    RemoveAt(s_Data->IndexOfSlot[projectile.Slot]);
+}
+
+void ProjectileSystem::Clear()
+{
+    if (!s_Data) return;
+
+    while (s_Data->Count > 0)
+        RemoveAt(s_Data->Count - 1);
+}
+
+void ProjectileSystem::Update(float deltaTime)
+{
+    if (!s_Data) return;
+
+    ProjectileData& d = *s_Data;
+    d.Expired.clear();
+
+    uint32_t i = 0;
+
+#if defined(PROJECTILE_SIMD_SSE)
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    const __m128 zero = _mm_setzero_ps();
+
+    for (; i + 4 <= d.Count; i += 4)
+    {
+        __m128 x = _mm_loadu_ps(&d.PositionX[i]);
+        __m128 y = _mm_loadu_ps(&d.PositionY[i]);
+        _mm_storeu_ps(&d.PrevX[i], x);
+        _mm_storeu_ps(&d.PrevY[i], y);
+
+        x = _mm_add_ps(x, _mm_mul_ps(_mm_loadu_ps(&d.VelocityX[i]), dt));
+        y = _mm_add_ps(y, _mm_mul_ps(_mm_loadu_ps(&d.VelocityY[i]), dt));
+        _mm_storeu_ps(&d.PositionX[i], x);
+        _mm_storeu_ps(&d.PositionY[i], y);
+
+        __m128 life = _mm_sub_ps(_mm_loadu_ps(&d.Lifetime[i]), dt);
+        _mm_storeu_ps(&d.Lifetime[i], life);
+
+        int expired = _mm_movemask_ps(_mm_cmple_ps(life, zero));
+        for (uint32_t lane = 0; expired != 0; lane++, expired >>= 1)
+        {
+            if (expired & 1) d.Expired.push_back(i + lane);
+        }
+    }
+#endif
+
+    for (; i < d.Count; i++)
+    {
+        d.PrevX[i] = d.PositionX[i];
+        d.PrevY[i] = d.PositionY[i];
+        d.PositionX[i] += d.VelocityX[i] * deltaTime;
+        d.PositionY[i] += d.VelocityY[i] * deltaTime;
+        d.Lifetime[i] -= deltaTime;
+        if (d.Lifetime[i] <= 0.0f) d.Expired.push_back(i);
+    }
+
+    // Highest first, so the projectile moved into each hole is one that already survived
+    for (size_t k = d.Expired.size(); k-- > 0;)
+        RemoveAt(d.Expired[k]);
+
+    d.Uploaded = false;
+}
+
+void ProjectileSystem::DispatchHits(HitFunction function, void* context)
+{
+    if (!s_Data) return;
+
+    ProjectileData& d = *s_Data;
+    BoxCollider& probe = *d.Probe;
+
+    // Backwards, so removing a projectile only moves one that was already handled
+    for (uint32_t i = d.Count; i-- > 0;)
+    {
+        if (i >= d.Count) continue;  // The callback cleared the pool
+
+        glm::vec2 from(d.PrevX[i], d.PrevY[i]);
+        glm::vec2 to(d.PositionX[i], d.PositionY[i]);
+
+        d.ProbeOwner.SetPosition(from);
+        probe.SetSize(glm::vec2(d.SizeX[i], d.SizeY[i]));
+        probe.SetCategory(d.Category[i]);
+        probe.SetMask(d.Mask[i]);
+
+        RaycastHit hit;
+        if (!Physics::Sweep(&probe, from, to, hit)) continue;
+
+        ProjectileHandle projectile;
+        projectile.Slot = d.SlotOfIndex[i];
+        projectile.Generation = d.Generation[projectile.Slot];
+
+        if (function(context, projectile, hit))
+            Kill(projectile);
+    }
+}
+
+void ProjectileSystem::Render()
+{
+    if (!s_Data || s_Data->Count == 0) return;
+
+    ProjectileData& d = *s_Data;
+
+    glBindBuffer(GL_ARRAY_BUFFER, d.InstanceVBO);
+    if (!d.Uploaded)
+    {
+        // Each array straight into its region; only the live part is copied
+        size_t region = (size_t)d.Capacity * sizeof(float);
+        size_t bytes = (size_t)d.Count * sizeof(float);
+        glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, d.PositionX.data());
+        glBufferSubData(GL_ARRAY_BUFFER, region, bytes, d.PositionY.data());
+        glBufferSubData(GL_ARRAY_BUFFER, region * 2, bytes, d.SizeX.data());
+        glBufferSubData(GL_ARRAY_BUFFER, region * 3, bytes, d.SizeY.data());
+        glBufferSubData(GL_ARRAY_BUFFER, region * 4, (size_t)d.Count * sizeof(glm::vec4), d.Color.data());
+        d.Uploaded = true;
+    }
+
+    d.ProjectileShader->Bind();
+    glUniformMatrix4fv(d.ViewProjectionLocation, 1, GL_FALSE, &Renderer::GetViewProjectionMatrix()[0][0]);
+
+    glBindVertexArray(d.VAO);
+    glDrawArraysInstanced(GL_TRIANGLES, 0, 6, (GLsizei)d.Count);
+    glBindVertexArray(0);
+
+    // Hand the pipeline back to the quad renderer
+    Renderer::BindQuadShader();
+}
+
+uint32_t ProjectileSystem::GetCount()
+{
+    return s_Data ? s_Data->Count : 0;
+}
+
+uint32_t ProjectileSystem::GetCapacity()
+{
+    return s_Data ? s_Data->Capacity : 0;
+}
@@ -2,7 +2,13 @@
 #include <glm/gtc/matrix_transform.hpp>
 
 Camera::Camera(float width, float height)
-    : m_Position(0.0f, 0.0f), m_Zoom(1.0f), m_Width(width), m_Height(height)
+    : m_IsDirty(true)
+    , m_Position(0.0f, 0.0f)
+    , m_Zoom(1.0f)
+    , m_Width(width)
+    , m_Height(height)
+    , m_ViewportRect(0.0f, 0.0f, 1.0f, 1.0f)
+    , m_IsActive(true)
 {
     RecalculateViewProjection();
 }
@@ -10,24 +16,68 @@ Camera::Camera(float width, float height)
 void Camera::SetPosition(const glm::vec2& position)
 {
     m_Position = position;
-    RecalculateViewProjection();
+    m_IsDirty = true;
 }
 
 void Camera::SetZoom(float zoom)
 {
     // Prevent zoom from going to 0 or negative
     m_Zoom = glm::max(zoom, 0.01f);
-    RecalculateViewProjection();
+    m_IsDirty = true;
 }
 
 void Camera::SetViewportSize(float width, float height)
 {
     m_Width = width;
     m_Height = height;
-    RecalculateViewProjection();
+    m_IsDirty = true;
+}
+
+const glm::mat4& Camera::GetViewProjectionMatrix() const
+{
+    UpdateIfDirty();
+    return m_ViewProjectionMatrix;
+}
+
+const glm::mat4& Camera::GetInverseViewProjectionMatrix() const
+{
+    UpdateIfDirty();
+    return m_InverseViewProjectionMatrix;
+}
+
+const glm::vec4& Camera::GetVisibleBounds() const
+{
+    UpdateIfDirty();
+    return m_VisibleBounds;
+}
+
+bool Camera::IsBoxVisible(const glm::vec2& center, const glm::vec2& size) const
+{
+    const glm::vec4& bounds = GetVisibleBounds();
+    glm::vec2 half = size * 0.5f;
+
+    return center.x + half.x >= bounds.x && center.x - half.x <= bounds.z &&
+           center.y + half.y >= bounds.y && center.y - half.y <= bounds.w;
+}
+
+glm::vec2 Camera::NdcToWorld(const glm::vec2& ndc) const
+{
+    glm::vec4 worldPos = GetInverseViewProjectionMatrix() * glm::vec4(ndc, 0.0f, 1.0f);
+    return glm::vec2(worldPos.x, worldPos.y);
+}
+
+void Camera::UpdateIfDirty() const
+{
+    if (m_IsDirty)
+        Rebuild();
 }
 
 void Camera::RecalculateViewProjection()
+{
+    Rebuild();
+}
+
+void Camera::Rebuild() const
 {
     // Orthographic projection for 2D
     // This creates a coordinate system where (0,0) is the center of the screen
@@ -46,4 +96,11 @@ void Camera::RecalculateViewProjection()
 
     // Combined matrix (order matters: projection * view)
     m_ViewProjectionMatrix = m_ProjectionMatrix * m_ViewMatrix;
-}
\ No newline at end of file
+    m_InverseViewProjectionMatrix = glm::inverse(m_ViewProjectionMatrix);
+
+    // Axis-aligned ortho camera: the visible area is just the frustum moved to the camera
+    m_VisibleBounds = glm::vec4(m_Position.x + left, m_Position.y + bottom,
+                                m_Position.x + right, m_Position.y + top);
+
+    m_IsDirty = false;
+}
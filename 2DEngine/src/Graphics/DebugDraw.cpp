@@ -0,0 +1,277 @@
+#include "Graphics/DebugDraw.h"
+
+#if ENGINE_DEBUG_DRAW
+
+#include "Graphics/Font.h"
+#include "Graphics/Renderer.h"
+#include "Graphics/Shader.h"
+#include "Graphics/TextRenderer.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <iostream>
+#include <vector>
+
+// What the fragment shader does with a vertex (DebugVertex::Shape.x)
+static constexpr float SHAPE_SOLID = 0.0f;
+static constexpr float SHAPE_CIRCLE = 1.0f;  // Local = position on the unit disc
+static constexpr float SHAPE_TEXT = 2.0f;    // Local = font atlas texel
+
+// Inner radius (fraction of the outer) that cuts nothing out of a circle
+static constexpr float FILLED = -1.0f;
+
+struct DebugVertex
+{
+    glm::vec2 Position;
+    glm::vec2 Local;
+    glm::vec4 Color;
+    glm::vec2 Shape;  // Kind, circle inner radius
+};
+
+struct DebugDraw::DebugDrawData
+{
+    unsigned int VAO = 0;
+    unsigned int VBO = 0;
+    std::unique_ptr<Shader> DebugShader;
+
+    std::vector<DebugVertex> Vertices;  // Capacity is kept between frames
+    size_t BufferCapacity = 0;          // Vertices the GPU buffer can hold
+    bool Uploaded = false;              // GPU buffer matches Vertices
+};
+
+std::unique_ptr<DebugDraw::DebugDrawData> DebugDraw::s_Data = nullptr;
+
+void DebugDraw::Init()
+{
+    s_Data = std::make_unique<DebugDrawData>();
+
+    glGenVertexArrays(1, &s_Data->VAO);
+    glGenBuffers(1, &s_Data->VBO);
+
+    glBindVertexArray(s_Data->VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, s_Data->VBO);
+
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(DebugVertex), (void*)offsetof(DebugVertex, Position));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(DebugVertex), (void*)offsetof(DebugVertex, Local));
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(DebugVertex), (void*)offsetof(DebugVertex, Color));
+    glEnableVertexAttribArray(3);
+    glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(DebugVertex), (void*)offsetof(DebugVertex, Shape));
+
+    glBindVertexArray(0);
+
+    s_Data->DebugShader = std::make_unique<Shader>(
+        "assets/shaders/debug.vert",
+        "assets/shaders/debug.frag"
+    );
+
+    s_Data->DebugShader->Bind();
+    s_Data->DebugShader->SetInt("u_FontAtlas", 0);
+    s_Data->DebugShader->Unbind();
+
+    std::cout << "DebugDraw initialized\n";
+}
+
+void DebugDraw::Shutdown()
+{
+    if (s_Data)
+    {
+        glDeleteVertexArrays(1, &s_Data->VAO);
+        glDeleteBuffers(1, &s_Data->VBO);
+        s_Data.reset();
+    }
+}
+
+// Two triangles over the quad a-b-c-d (counter-clockwise), with matching local coordinates
+static void PushQuad(std::vector<DebugVertex>& out, const glm::vec2 corners[4], const glm::vec2 local[4],
+                     const glm::vec4& color, const glm::vec2& shape)
+{
+    static const int ORDER[6] = { 0, 1, 2, 2, 3, 0 };
+    for (int i : ORDER)
+        out.push_back({ corners[i], local[i], color, shape });
+}
+
+static void PushBox(std::vector<DebugVertex>& out, const glm::vec2& min, const glm::vec2& max, const glm::vec4& color)
+{
+    const glm::vec2 corners[4] = { min, glm::vec2(max.x, min.y), max, glm::vec2(min.x, max.y) };
+    const glm::vec2 local[4] = {};
+    PushQuad(out, corners, local, color, glm::vec2(SHAPE_SOLID, 0.0f));
+}
+
+void DebugDraw::Line(const glm::vec2& from, const glm::vec2& to, const glm::vec4& color, float thickness)
+{
+    if (!s_Data) return;
+
+    glm::vec2 d = to - from;
+    float length = glm::length(d);
+    if (length <= 0.0f) return;
+
+    glm::vec2 side = glm::vec2(-d.y, d.x) / length * (thickness * 0.5f);
+    const glm::vec2 corners[4] = { from - side, to - side, to + side, from + side };
+    const glm::vec2 local[4] = {};
+    PushQuad(s_Data->Vertices, corners, local, color, glm::vec2(SHAPE_SOLID, 0.0f));
+    s_Data->Uploaded = false;
+}
+
+void DebugDraw::Rect(const glm::vec2& center, const glm::vec2& size, const glm::vec4& color, float thickness)
+{
+    if (!s_Data) return;
+
+    glm::vec2 min = center - size * 0.5f;
+    glm::vec2 max = center + size * 0.5f;
+    float t = std::min(thickness, std::min(size.x, size.y) * 0.5f);
+
+    // Four bands that don't overlap, so translucent colors stay even at the corners
+    PushBox(s_Data->Vertices, min, glm::vec2(max.x, min.y + t), color);
+    PushBox(s_Data->Vertices, glm::vec2(min.x, max.y - t), max, color);
+    PushBox(s_Data->Vertices, glm::vec2(min.x, min.y + t), glm::vec2(min.x + t, max.y - t), color);
+    PushBox(s_Data->Vertices, glm::vec2(max.x - t, min.y + t), glm::vec2(max.x, max.y - t), color);
+    s_Data->Uploaded = false;
+}
+
+void DebugDraw::FilledRect(const glm::vec2& center, const glm::vec2& size, const glm::vec4& color)
+{
+    if (!s_Data) return;
+
+    PushBox(s_Data->Vertices, center - size * 0.5f, center + size * 0.5f, color);
+    s_Data->Uploaded = false;
+}
+
+// Quad around the disc; the shader keeps distances from 'inner' to 1
+static void PushDisc(std::vector<DebugVertex>& out, const glm::vec2& center, float radius, float inner,
+                     const glm::vec4& color)
+{
+    const glm::vec2 corners[4] = {
+        center + glm::vec2(-radius, -radius), center + glm::vec2(radius, -radius),
+        center + glm::vec2(radius, radius), center + glm::vec2(-radius, radius)
+    };
+    const glm::vec2 local[4] = { glm::vec2(-1.0f, -1.0f), glm::vec2(1.0f, -1.0f), glm::vec2(1.0f, 1.0f), glm::vec2(-1.0f, 1.0f) };
+    PushQuad(out, corners, local, color, glm::vec2(SHAPE_CIRCLE, inner));
+}
+
+void DebugDraw::Circle(const glm::vec2& center, float radius, const glm::vec4& color, float thickness)
+{
+    if (!s_Data || radius <= 0.0f) return;
+
+    PushDisc(s_Data->Vertices, center, radius, std::max(1.0f - thickness / radius, 0.0f), color);
+    s_Data->Uploaded = false;
+}
+
+void DebugDraw::FilledCircle(const glm::vec2& center, float radius, const glm::vec4& color)
+{
+    if (!s_Data || radius <= 0.0f) return;
+
+    PushDisc(s_Data->Vertices, center, radius, FILLED, color);
+    s_Data->Uploaded = false;
+}
+
+void DebugDraw::Text(std::string_view text, const glm::vec2& position, const glm::vec4& color, float scale)
+{
+    const Font* font = TextRenderer::GetBuiltinFont();
+    if (!s_Data || !font) return;
+
+    // The built-in font is ASCII on its baked page, so glyphs map straight to atlas cells
+    float texelSize = font->GetTexelSize(scale);
+    glm::vec2 pen = position;
+
+    for (char c : text)
+    {
+        if (c == '\n')
+        {
+            pen.x = position.x;
+            pen.y -= font->GetLineAdvance() * texelSize;
+            continue;
+        }
+
+        const Glyph* glyph = font->GetGlyph((uint32_t)(unsigned char)c);
+        if (!glyph)
+        {
+            pen.x += font->GetFallbackAdvance() * texelSize;
+            continue;
+        }
+
+        if (glyph->Size.x > 0.0f && glyph->Size.y > 0.0f)
+        {
+            float x0 = pen.x + glyph->Bearing.x * texelSize;
+            float x1 = x0 + glyph->Size.x * texelSize;
+            float y0 = pen.y + glyph->Bearing.y * texelSize;
+            float y1 = y0 - glyph->Size.y * texelSize;
+
+            // Atlas rows run top-down while world Y runs up
+            const glm::vec4& rect = glyph->AtlasRect;
+            const glm::vec2 corners[4] = { glm::vec2(x0, y1), glm::vec2(x1, y1), glm::vec2(x1, y0), glm::vec2(x0, y0) };
+            const glm::vec2 local[4] = {
+                glm::vec2(rect.x, rect.w), glm::vec2(rect.z, rect.w), glm::vec2(rect.z, rect.y), glm::vec2(rect.x, rect.y)
+            };
+            PushQuad(s_Data->Vertices, corners, local, color, glm::vec2(SHAPE_TEXT, 0.0f));
+        }
+
+        pen.x += glyph->Advance * texelSize;
+    }
+
+    s_Data->Uploaded = false;
+}
+
+void DebugDraw::Textf(const glm::vec2& position, const glm::vec4& color, float scale, const char* format, ...)
+{
+    char buffer[FORMAT_BUFFER_SIZE];
+
+    va_list args;
+    va_start(args, format);
+    int length = std::vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    if (length < 0) return;
+    Text(std::string_view(buffer, std::min((size_t)length, sizeof(buffer) - 1)), position, color, scale);
+}
+
+void DebugDraw::Render(const glm::mat4& viewProjection)
+{
+    if (!s_Data || s_Data->Vertices.empty()) return;
+
+    glBindBuffer(GL_ARRAY_BUFFER, s_Data->VBO);
+    if (!s_Data->Uploaded)
+    {
+        // Grow the buffer geometrically, otherwise just overwrite what's there
+        size_t bytes = s_Data->Vertices.size() * sizeof(DebugVertex);
+        if (s_Data->Vertices.size() > s_Data->BufferCapacity)
+        {
+            s_Data->BufferCapacity = std::max(s_Data->Vertices.size(), s_Data->BufferCapacity * 2);
+            glBufferData(GL_ARRAY_BUFFER, s_Data->BufferCapacity * sizeof(DebugVertex), nullptr, GL_STREAM_DRAW);
+        }
+        glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, s_Data->Vertices.data());
+        s_Data->Uploaded = true;
+    }
+
+    s_Data->DebugShader->Bind();
+    s_Data->DebugShader->SetMat4("u_ViewProjection", viewProjection);
+
+    glActiveTexture(GL_TEXTURE0);
+    const Font* font = TextRenderer::GetBuiltinFont();
+    glBindTexture(GL_TEXTURE_2D, font ? font->GetAtlasID() : 0);
+
+    glBindVertexArray(s_Data->VAO);
+    glDrawArrays(GL_TRIANGLES, 0, (GLsizei)s_Data->Vertices.size());
+    glBindVertexArray(0);
+
+    // Hand the pipeline back to the quad renderer
+    Renderer::BindQuadShader();
+}
+
+void DebugDraw::NewFrame()
+{
+    if (!s_Data) return;
+
+    s_Data->Vertices.clear();
+    s_Data->Uploaded = false;
+}
+
+size_t DebugDraw::GetVertexCount()
+{
+    return s_Data ? s_Data->Vertices.size() : 0;
+}
+
+#endif
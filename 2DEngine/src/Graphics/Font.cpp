@@ -1,3 +1,585 @@
-//
-// Created by leona on 1/23/2026.
-//
\ No newline at end of file
+#include "Graphics/Font.h"
+#include "Graphics/TrueType.h"
+#include "Core/Hash.h"
+
+#include <glad/glad.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+// SDF generation parameters (see TrueTypeFont::RenderGlyphSDF)
+static constexpr int SDF_PADDING = 6;           // Texels of distance stored around each glyph
+static constexpr unsigned char SDF_ON_EDGE = 128;
+static constexpr float SDF_PIXEL_DIST_SCALE = (float)SDF_ON_EDGE / SDF_PADDING;
+static constexpr int SDF_ATLAS_WIDTH = 512;
+
+// Dynamic glyph pages (square, single channel) and how many may exist by default
+static constexpr int DYNAMIC_PAGE_SIZE = 512;
+static constexpr uint32_t DEFAULT_PAGE_BUDGET = 4;
+
+// scale 1.0 renders a TTF font line this many world units tall
+static constexpr float SDF_WORLD_HEIGHT = 16.0f;
+
+// Bump when the cache layout or SDF parameters change
+static constexpr uint32_t FONT_CACHE_MAGIC = 0x43464453;  // "SDFC"
+static constexpr uint32_t FONT_CACHE_VERSION = 2;
+
+// Sanity limits for a cache file's header; anything larger is treated as corrupt
+static constexpr uint32_t FONT_CACHE_MAX_GLYPHS = 1024;
+static constexpr int32_t FONT_CACHE_MAX_ATLAS_HEIGHT = 4096;
+
+static std::string s_CacheDirectory;
+static uint32_t s_NextFontID = 1;
+
+// ============================================
+// Font
+// ============================================
+
+struct Font::GlyphSource
+{
+    std::vector<unsigned char> FontFile;
+    TrueTypeFont Info;
+    float PixelScale = 0.0f;  // Font units -> raster pixels
+    float Ascent = 0.0f;      // Raster pixels above the baseline
+};
+
+Font::Font(FontType type, float unitsPerTexel)
+    : m_Type(type)
+    , m_ID(s_NextFontID++)
+    , m_UnitsPerTexel(unitsPerTexel)
+    , m_LineHeight(0.0f)
+    , m_LineAdvance(0.0f)
+    , m_FallbackAdvance(0.0f)
+    , m_DistanceScale(1.0f)
+    , m_HasAsciiGlyph{}
+    , m_UseClock(0)
+    , m_PageBudget(DEFAULT_PAGE_BUDGET)
+{
+}
+
+Font::~Font()
+{
+    for (AtlasPage& page : m_Pages)
+    {
+        if (page.TextureID != 0)
+            glDeleteTextures(1, &page.TextureID);
+    }
+}
+
+static void UploadPage(unsigned int textureID, FontType type, const unsigned char* pixels, int width, int height)
+{
+    glBindTexture(GL_TEXTURE_2D, textureID);
+
+    // Bitmap glyphs keep their hard edges; distance fields need interpolation
+    GLint filter = (type == FontType::SDF) ? GL_LINEAR : GL_NEAREST;
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, width, height, 0, GL_RED, GL_UNSIGNED_BYTE, pixels);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+void Font::SetAtlas(const unsigned char* pixels, int width, int height)
+{
+    if (m_Pages.empty())
+    {
+        m_Pages.emplace_back();
+        glGenTextures(1, &m_Pages[0].TextureID);
+    }
+
+    AtlasPage& page = m_Pages[0];
+    page.Size = glm::ivec2(width, height);
+    page.Pinned = true;
+    page.PenY = height;  // Baked page is full; new glyphs go to dynamic pages
+
+    UploadPage(page.TextureID, m_Type, pixels, width, height);
+    m_Stats.PageCount = (uint32_t)m_Pages.size();
+}
+
+void Font::AddGlyph(uint32_t codepoint, const Glyph& glyph)
+{
+    m_MissingGlyphs.erase(codepoint);
+
+    if (codepoint < 128)
+    {
+        m_AsciiGlyphs[codepoint] = glyph;
+        m_HasAsciiGlyph[codepoint] = true;
+        return;
+    }
+
+    m_Glyphs[codepoint] = glyph;
+}
+
+const Glyph* Font::GetGlyph(uint32_t codepoint) const
+{
+    if (codepoint < 128 && m_HasAsciiGlyph[codepoint])
+    {
+        m_Stats.Hits++;
+        return &m_AsciiGlyphs[codepoint];
+    }
+
+    auto it = m_Glyphs.find(codepoint);
+    if (it != m_Glyphs.end())
+    {
+        m_Stats.Hits++;
+        TouchPage(it->second.Page);
+        return &it->second;
+    }
+
+    // Codepoints the font can't supply are remembered, so they miss only once
+    if (m_MissingGlyphs.count(codepoint))
+        return nullptr;
+
+    m_Stats.Misses++;
+    const Glyph* glyph = RasterizeGlyph(codepoint);
+    if (!glyph)
+        m_MissingGlyphs.insert(codepoint);
+    return glyph;
+}
+
+void Font::TouchPage(uint32_t page) const
+{
+    if (page < m_Pages.size())
+        m_Pages[page].LastUsed = ++m_UseClock;
+}
+
+void Font::SetPageBudget(uint32_t pages)
+{
+    m_PageBudget = std::max(pages, 1u);
+}
+
+void Font::ResetCacheStats()
+{
+    m_Stats.Hits = 0;
+    m_Stats.Misses = 0;
+    m_Stats.Evictions = 0;
+}
+
+uint32_t Font::CreatePage() const
+{
+    AtlasPage page;
+    page.Size = glm::ivec2(DYNAMIC_PAGE_SIZE);
+    glGenTextures(1, &page.TextureID);
+
+    std::vector<unsigned char> zeros((size_t)DYNAMIC_PAGE_SIZE * DYNAMIC_PAGE_SIZE, 0);
+    UploadPage(page.TextureID, m_Type, zeros.data(), DYNAMIC_PAGE_SIZE, DYNAMIC_PAGE_SIZE);
+
+    m_Pages.push_back(page);
+    m_Stats.PageCount = (uint32_t)m_Pages.size();
+    return (uint32_t)m_Pages.size() - 1;
+}
+
+void Font::EvictPage(uint32_t pageIndex) const
+{
+    AtlasPage& page = m_Pages[pageIndex];
+
+    for (auto it = m_Glyphs.begin(); it != m_Glyphs.end();)
+    {
+        // Whitespace sits on page 0 with no bitmap and is never evicted
+        if (it->second.Page == pageIndex && it->second.Size.x > 0.0f)
+            it = m_Glyphs.erase(it);
+        else
+            ++it;
+    }
+
+    // Clear the old pixels so filtering at glyph edges never picks them up
+    std::vector<unsigned char> zeros((size_t)page.Size.x * page.Size.y, 0);
+    glBindTexture(GL_TEXTURE_2D, page.TextureID);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, page.Size.x, page.Size.y, GL_RED, GL_UNSIGNED_BYTE, zeros.data());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    page.PenX = 1;
+    page.PenY = 1;
+    page.ShelfHeight = 0;
+    page.Generation++;
+
+    m_Stats.Evictions++;
+}
+
+bool Font::AllocateRect(int width, int height, uint32_t& outPage, glm::ivec2& outPos) const
+{
+    if (width + 2 > DYNAMIC_PAGE_SIZE || height + 2 > DYNAMIC_PAGE_SIZE)
+        return false;
+
+    // Leaves a one-texel gap so bilinear sampling never bleeds between glyphs
+    auto tryPack = [&](AtlasPage& page) -> bool
+    {
+        int x = page.PenX, y = page.PenY, shelf = page.ShelfHeight;
+        if (x + width + 1 > page.Size.x)
+        {
+            x = 1;
+            y += shelf + 1;
+            shelf = 0;
+        }
+        if (y + height + 1 > page.Size.y)
+            return false;
+
+        outPos = glm::ivec2(x, y);
+        page.PenX = x + width + 1;
+        page.PenY = y;
+        page.ShelfHeight = std::max(shelf, height);
+        return true;
+    };
+
+    uint32_t dynamicPages = 0;
+    uint32_t lruPage = 0;
+    uint64_t lruTime = UINT64_MAX;
+
+    for (uint32_t i = 0; i < m_Pages.size(); i++)
+    {
+        AtlasPage& page = m_Pages[i];
+        if (page.Pinned) continue;
+
+        dynamicPages++;
+        if (tryPack(page))
+        {
+            outPage = i;
+            return true;
+        }
+
+        if (page.LastUsed < lruTime)
+        {
+            lruTime = page.LastUsed;
+            lruPage = i;
+        }
+    }
+
+    // Grow while under budget, otherwise recycle the least recently used page
+    if (dynamicPages < m_PageBudget)
+        outPage = CreatePage();
+    else
+    {
+        outPage = lruPage;
+        EvictPage(outPage);
+    }
+
+    return tryPack(m_Pages[outPage]);
+}
+
+void Font::SetLineMetrics(float lineHeight, float lineAdvance)
+{
+    m_LineHeight = lineHeight;
+    m_LineAdvance = lineAdvance;
+}
+
+void Font::SetCacheDirectory(const std::string& directory)
+{
+    s_CacheDirectory = directory;
+}
+
+// ============================================
+// SDF atlas disk cache
+// ============================================
+
+struct FontCacheHeader
+{
+    uint32_t Magic;
+    uint32_t Version;
+    uint64_t FontHash;
+    uint32_t PixelHeight;
+    uint32_t GlyphCount;
+    int32_t AtlasWidth;
+    int32_t AtlasHeight;
+    float LineHeight;
+    float LineAdvance;
+    float FallbackAdvance;
+    float DistanceScale;
+};
+
+struct FontCacheGlyph
+{
+    uint32_t Codepoint;
+    Glyph Metrics;
+};
+
+struct FontAtlasData
+{
+    FontCacheHeader Header{};
+    std::vector<FontCacheGlyph> Glyphs;
+    std::vector<unsigned char> Pixels;
+};
+
+static std::filesystem::path GetCachePath(uint64_t fontHash, unsigned int pixelHeight)
+{
+    std::filesystem::path dir;
+    if (!s_CacheDirectory.empty())
+    {
+        dir = s_CacheDirectory;
+    }
+    else
+    {
+        std::error_code ec;
+        dir = std::filesystem::temp_directory_path(ec);
+        dir /= "2DEngine";
+        dir /= "fontcache";
+    }
+
+    char name[64];
+    std::snprintf(name, sizeof(name), "%016llx_%u.sdf", (unsigned long long)fontHash, pixelHeight);
+    return dir / name;
+}
+
+static bool ReadAtlasCache(const std::filesystem::path& path, uint64_t fontHash, unsigned int pixelHeight,
+                           FontAtlasData& out)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in.is_open()) return false;
+
+    in.read(reinterpret_cast<char*>(&out.Header), sizeof(out.Header));
+    if (!in) return false;
+
+    const FontCacheHeader& h = out.Header;
+    if (h.Magic != FONT_CACHE_MAGIC || h.Version != FONT_CACHE_VERSION ||
+        h.FontHash != fontHash || h.PixelHeight != pixelHeight)
+        return false;
+
+    // The header is untrusted: bound it before sizing anything from it
+    if (h.GlyphCount > FONT_CACHE_MAX_GLYPHS || h.AtlasWidth != SDF_ATLAS_WIDTH ||
+        h.AtlasHeight <= 0 || h.AtlasHeight > FONT_CACHE_MAX_ATLAS_HEIGHT)
+        return false;
+
+    std::error_code ec;
+    uintmax_t fileSize = std::filesystem::file_size(path, ec);
+    uintmax_t expected = sizeof(FontCacheHeader) + (uintmax_t)h.GlyphCount * sizeof(FontCacheGlyph) +
+                         (uintmax_t)h.AtlasWidth * (uintmax_t)h.AtlasHeight;
+    if (ec || fileSize != expected)
+        return false;
+
+    out.Glyphs.resize(h.GlyphCount);
+    out.Pixels.resize((size_t)h.AtlasWidth * (size_t)h.AtlasHeight);
+
+    in.read(reinterpret_cast<char*>(out.Glyphs.data()), out.Glyphs.size() * sizeof(FontCacheGlyph));
+    in.read(reinterpret_cast<char*>(out.Pixels.data()), out.Pixels.size());
+    return (bool)in;
+}
+
+static void WriteAtlasCache(const std::filesystem::path& path, const FontAtlasData& data)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open())
+    {
+        std::cerr << "Failed to write font cache: " << path.string() << "\n";
+        return;
+    }
+
+    out.write(reinterpret_cast<const char*>(&data.Header), sizeof(data.Header));
+    out.write(reinterpret_cast<const char*>(data.Glyphs.data()), data.Glyphs.size() * sizeof(FontCacheGlyph));
+    out.write(reinterpret_cast<const char*>(data.Pixels.data()), data.Pixels.size());
+}
+
+// ============================================
+// SDF rasterization
+// ============================================
+
+// Render one glyph's distance field; returns false for glyphs without a bitmap (whitespace)
+static bool RasterizeGlyphSDF(const TrueTypeFont& info, float pxScale, float ascent, uint32_t codepoint,
+                              Glyph& outMetrics, std::vector<unsigned char>& outPixels, int& outWidth, int& outHeight)
+{
+    uint32_t glyph = info.FindGlyphIndex(codepoint);
+
+    int xoff = 0, yoff = 0;
+    bool hasBitmap = info.RenderGlyphSDF(glyph, pxScale, SDF_PADDING, SDF_ON_EDGE, SDF_PIXEL_DIST_SCALE,
+                                         outPixels, outWidth, outHeight, xoff, yoff);
+
+    int advance = 0, lsb = 0;
+    info.GetGlyphHMetrics(glyph, advance, lsb);
+
+    outMetrics = Glyph();
+    outMetrics.Advance = advance * pxScale;
+    if (hasBitmap)
+    {
+        outMetrics.Size = glm::vec2((float)outWidth, (float)outHeight);
+        // yoff is baseline -> top (Y down); the pen sits on the top of the line
+        outMetrics.Bearing = glm::vec2((float)xoff, -(ascent + (float)yoff));
+    }
+    return hasBitmap;
+}
+
+static bool RasterizeAtlas(const std::vector<unsigned char>& fontFile, unsigned int pixelHeight,
+                           FontAtlasData& out)
+{
+    TrueTypeFont info;
+    if (!info.Init(fontFile.data(), fontFile.size()))
+        return false;
+
+    float pxScale = info.ScaleForPixelHeight((float)pixelHeight);
+
+    int ascent = info.GetAscent();
+    int descent = info.GetDescent();
+    int lineGap = info.GetLineGap();
+
+    struct RasterGlyph
+    {
+        uint32_t Codepoint;
+        std::vector<unsigned char> Pixels;  // Empty for whitespace
+        int Width, Height;
+        FontCacheGlyph Record;
+    };
+
+    std::vector<RasterGlyph> raster;
+
+    // Printable ASCII is baked up front
+    for (uint32_t cp = 32; cp < 127; cp++)
+    {
+        RasterGlyph g{};
+        g.Codepoint = cp;
+        g.Record.Codepoint = cp;
+        RasterizeGlyphSDF(info, pxScale, ascent * pxScale, cp, g.Record.Metrics, g.Pixels, g.Width, g.Height);
+
+        raster.push_back(std::move(g));
+    }
+
+    // Shelf-pack tallest first, with a one-texel gap so bilinear sampling never bleeds
+    std::vector<RasterGlyph*> order;
+    for (auto& g : raster) order.push_back(&g);
+    std::sort(order.begin(), order.end(),
+        [](const RasterGlyph* a, const RasterGlyph* b) { return a->Height > b->Height; });
+
+    int x = 1, y = 1, shelfHeight = 0;
+    for (RasterGlyph* g : order)
+    {
+        if (g->Pixels.empty()) continue;
+
+        if (x + g->Width + 1 > SDF_ATLAS_WIDTH)
+        {
+            x = 1;
+            y += shelfHeight + 1;
+            shelfHeight = 0;
+        }
+
+        g->Record.Metrics.AtlasRect = glm::vec4((float)x, (float)y, (float)(x + g->Width), (float)(y + g->Height));
+        x += g->Width + 1;
+        shelfHeight = std::max(shelfHeight, g->Height);
+    }
+
+    int atlasHeight = y + shelfHeight + 1;
+
+    out.Pixels.assign((size_t)SDF_ATLAS_WIDTH * atlasHeight, 0);
+    for (RasterGlyph& g : raster)
+    {
+        if (!g.Pixels.empty())
+        {
+            int ax = (int)g.Record.Metrics.AtlasRect.x;
+            int ay = (int)g.Record.Metrics.AtlasRect.y;
+            for (int row = 0; row < g.Height; row++)
+                std::memcpy(&out.Pixels[(size_t)(ay + row) * SDF_ATLAS_WIDTH + ax], &g.Pixels[(size_t)row * g.Width], g.Width);
+        }
+
+        out.Glyphs.push_back(g.Record);
+    }
+
+    FontCacheHeader& h = out.Header;
+    h.Magic = FONT_CACHE_MAGIC;
+    h.Version = FONT_CACHE_VERSION;
+    h.PixelHeight = pixelHeight;
+    h.GlyphCount = (uint32_t)out.Glyphs.size();
+    h.AtlasWidth = SDF_ATLAS_WIDTH;
+    h.AtlasHeight = atlasHeight;
+    h.LineHeight = (ascent - descent) * pxScale;
+    h.LineAdvance = (ascent - descent + lineGap) * pxScale;
+    h.FallbackAdvance = out.Glyphs.empty() ? 0.0f : out.Glyphs[0].Metrics.Advance;  // space
+    h.DistanceScale = 255.0f / SDF_PIXEL_DIST_SCALE;
+    return true;
+}
+
+const Glyph* Font::RasterizeGlyph(uint32_t codepoint) const
+{
+    if (!m_Source || m_Source->Info.FindGlyphIndex(codepoint) == 0)
+        return nullptr;
+
+    Glyph glyph;
+    std::vector<unsigned char> pixels;
+    int width = 0, height = 0;
+    if (RasterizeGlyphSDF(m_Source->Info, m_Source->PixelScale, m_Source->Ascent, codepoint, glyph, pixels,
+                          width, height))
+    {
+        glm::ivec2 pos;
+        if (!AllocateRect(width, height, glyph.Page, pos))
+            return nullptr;
+
+        AtlasPage& page = m_Pages[glyph.Page];
+        page.LastUsed = ++m_UseClock;
+
+        glBindTexture(GL_TEXTURE_2D, page.TextureID);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, pos.x, pos.y, width, height, GL_RED, GL_UNSIGNED_BYTE, pixels.data());
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+        glBindTexture(GL_TEXTURE_2D, 0);
+
+        glyph.AtlasRect = glm::vec4((float)pos.x, (float)pos.y, (float)(pos.x + width), (float)(pos.y + height));
+    }
+
+    return &(m_Glyphs[codepoint] = glyph);
+}
+
+std::unique_ptr<Font> Font::LoadTTF(const std::string& path, unsigned int pixelHeight)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+    {
+        std::cerr << "Failed to open font: " << path << "\n";
+        return nullptr;
+    }
+
+    std::vector<unsigned char> fontFile((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    uint64_t fontHash = HashBytes(fontFile.data(), fontFile.size());
+
+    std::filesystem::path cachePath = GetCachePath(fontHash, pixelHeight);
+
+    FontAtlasData atlas;
+    if (ReadAtlasCache(cachePath, fontHash, pixelHeight, atlas))
+    {
+        std::cout << "Loaded font atlas from cache: " << cachePath.string() << "\n";
+    }
+    else
+    {
+        atlas = FontAtlasData();
+        if (!RasterizeAtlas(fontFile, pixelHeight, atlas))
+        {
+            std::cerr << "Failed to parse TrueType font: " << path << "\n";
+            return nullptr;
+        }
+
+        atlas.Header.FontHash = fontHash;
+        WriteAtlasCache(cachePath, atlas);
+    }
+
+    const FontCacheHeader& h = atlas.Header;
+
+    auto font = std::make_unique<Font>(FontType::SDF, SDF_WORLD_HEIGHT / (float)pixelHeight);
+    font->SetAtlas(atlas.Pixels.data(), h.AtlasWidth, h.AtlasHeight);
+    font->SetLineMetrics(h.LineHeight, h.LineAdvance);
+    font->SetFallbackAdvance(h.FallbackAdvance);
+    font->SetDistanceScale(h.DistanceScale);
+
+    for (const FontCacheGlyph& g : atlas.Glyphs)
+        font->AddGlyph(g.Codepoint, g.Metrics);
+
+    // Keep the font data around so characters outside the baked set can be rasterized later
+    auto source = std::make_unique<GlyphSource>();
+    source->FontFile = std::move(fontFile);
+    if (source->Info.Init(source->FontFile.data(), source->FontFile.size()))
+    {
+        source->PixelScale = source->Info.ScaleForPixelHeight((float)pixelHeight);
+        source->Ascent = source->Info.GetAscent() * source->PixelScale;
+        font->m_Source = std::move(source);
+    }
+
+    std::cout << "Loaded font: " << path << " (" << h.GlyphCount << " glyphs, "
+              << h.AtlasWidth << "x" << h.AtlasHeight << " SDF atlas)\n";
+    return font;
+}
@@ -99,6 +99,16 @@ void Renderer::EndScene()
     s_Data->QuadShader->Unbind();
 }
 
+const glm::mat4& Renderer::GetViewProjectionMatrix()
+{
+    return s_Data->ViewProjectionMatrix;
+}
+
+void Renderer::BindQuadShader()
+{
+    s_Data->QuadShader->Bind();
+}
+
 void Renderer::Clear(const glm::vec4& color)
 {
     glClearColor(color.r, color.g, color.b, color.a);
@@ -0,0 +1,183 @@
+#include "Graphics/TextCache.h"
+#include "Graphics/TextRenderer.h"
+#include "Graphics/Font.h"
+#include "Core/Hash.h"
+
+#include <glad/glad.h>
+#include <unordered_map>
+#include <vector>
+
+struct TextCache::CacheData
+{
+    std::unordered_map<uint64_t, TextMeshHandle> Entries;
+    std::vector<TextVertex> Scratch;  // Reused while tessellating
+
+    uint64_t FrameIndex = 0;
+    uint32_t EvictAfterFrames = 120;
+};
+
+std::unique_ptr<TextCache::CacheData> TextCache::s_Data = nullptr;
+
+TextMesh::~TextMesh()
+{
+    // GL objects can only be released while the context is still alive
+    if (!TextCache::IsInitialized()) return;
+
+    if (VBO) glDeleteBuffers(1, &VBO);
+    if (VAO) glDeleteVertexArrays(1, &VAO);
+}
+
+static void UploadMesh(TextMesh& mesh, const std::vector<TextVertex>& vertices)
+{
+    glGenVertexArrays(1, &mesh.VAO);
+    glGenBuffers(1, &mesh.VBO);
+
+    glBindVertexArray(mesh.VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, mesh.VBO);
+    glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(TextVertex), vertices.data(), GL_STATIC_DRAW);
+
+    TextRenderer::SetVertexAttributes();
+
+    glBindVertexArray(0);
+
+    mesh.VertexCount = (int)vertices.size();
+}
+
+void TextCache::Init()
+{
+    s_Data = std::make_unique<CacheData>();
+}
+
+void TextCache::Shutdown()
+{
+    if (!s_Data) return;
+
+    // Release GL buffers before the cache (and the context) goes away
+    s_Data->Entries.clear();
+    s_Data.reset();
+}
+
+static TextMeshHandle BuildMesh(const TextLayoutHandle& layout, const glm::vec4& color,
+                                std::vector<TextVertex>& scratch, uint64_t frameIndex)
+{
+    auto mesh = std::make_shared<TextMesh>();
+    mesh->Layout = layout;
+    mesh->Color = color;
+    mesh->LastUsedFrame = frameIndex;
+
+    scratch.clear();
+    TextRenderer::BuildTextVertices(*layout, scratch, *mesh);
+
+    if (!scratch.empty())
+    {
+        UploadMesh(*mesh, scratch);
+    }
+
+    return mesh;
+}
+
+TextMeshHandle TextCache::Get(std::string_view text, float scale, const glm::vec4& color, const Font* font)
+{
+    return Get(text, TextLayoutParams(scale, TextAlign::Left, 0.0f, font), color);
+}
+
+TextMeshHandle TextCache::Get(std::string_view text, const TextLayoutParams& params, const glm::vec4& color)
+{
+    if (!s_Data) return nullptr;
+
+    const Font* font = params.LayoutFont ? params.LayoutFont : TextRenderer::GetActiveFont();
+    if (!font) return nullptr;
+
+    // Hits never touch the layout cache; the key is the layout key plus the color
+    uint64_t key = HashCombine(TextLayoutCache::ComputeKey(text, params, *font), color);
+
+    auto it = s_Data->Entries.find(key);
+    if (it != s_Data->Entries.end())
+    {
+        const TextMesh& cached = *it->second;
+        if (cached.Color == color && cached.Layout->Matches(text, params, font) && IsCurrent(cached))
+        {
+            cached.LastUsedFrame = s_Data->FrameIndex;
+            return it->second;
+        }
+    }
+
+    // Miss (or hash collision): tessellate and upload once
+    TextLayoutHandle layout = TextLayoutCache::Get(text, params);
+    if (!layout) return nullptr;
+
+    TextMeshHandle mesh = BuildMesh(layout, color, s_Data->Scratch, s_Data->FrameIndex);
+    s_Data->Entries[key] = mesh;
+    return mesh;
+}
+
+TextMeshHandle TextCache::Get(const TextLayoutHandle& layout, const glm::vec4& color)
+{
+    if (!s_Data || !layout) return nullptr;
+
+    uint64_t key = HashCombine(layout->Hash, color);
+
+    auto it = s_Data->Entries.find(key);
+    if (it != s_Data->Entries.end())
+    {
+        const TextMesh& cached = *it->second;
+        if (cached.Color == color && IsCurrent(cached) &&
+            (cached.Layout == layout || cached.Layout->Matches(layout->Text, layout->Params, layout->LayoutFont)))
+        {
+            cached.LastUsedFrame = s_Data->FrameIndex;
+            return it->second;
+        }
+    }
+
+    TextMeshHandle mesh = BuildMesh(layout, color, s_Data->Scratch, s_Data->FrameIndex);
+    s_Data->Entries[key] = mesh;
+    return mesh;
+}
+
+bool TextCache::IsCurrent(const TextMesh& mesh)
+{
+    if (!mesh.Layout) return false;
+
+    const Font& font = *mesh.Layout->LayoutFont;
+    for (const TextMeshRange& range : mesh.Ranges)
+    {
+        if (font.GetPageGeneration(range.Page) != range.Generation)
+            return false;
+    }
+    return true;
+}
+
+void TextCache::NewFrame()
+{
+    if (!s_Data) return;
+
+    s_Data->FrameIndex++;
+
+    for (auto it = s_Data->Entries.begin(); it != s_Data->Entries.end();)
+    {
+        if (s_Data->FrameIndex - it->second->LastUsedFrame > s_Data->EvictAfterFrames)
+            it = s_Data->Entries.erase(it);
+        else
+            ++it;
+    }
+}
+
+void TextCache::SetEvictAfterFrames(uint32_t frames)
+{
+    if (s_Data) s_Data->EvictAfterFrames = frames;
+}
+
+uint64_t TextCache::GetFrameIndex()
+{
+    return s_Data ? s_Data->FrameIndex : 0;
+}
+
+size_t TextCache::GetEntryCount()
+{
+    return s_Data ? s_Data->Entries.size() : 0;
+}
+
+void TextCache::Clear()
+{
+    if (s_Data) s_Data->Entries.clear();
+}
@@ -0,0 +1,326 @@
+#include "Graphics/TextLayout.h"
+#include "Graphics/TextRenderer.h"
+#include "Graphics/Font.h"
+#include "Core/Hash.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <unordered_map>
+
+struct TextLayoutCache::CacheData
+{
+    std::unordered_map<uint64_t, std::shared_ptr<TextLayout>> Entries;
+
+    uint64_t FrameIndex = 0;
+    uint32_t EvictAfterFrames = 120;
+};
+
+std::unique_ptr<TextLayoutCache::CacheData> TextLayoutCache::s_Data = nullptr;
+
+// Decode one UTF-8 sequence starting at text[i] and advance i past it.
+// Malformed input yields U+FFFD and skips a single byte.
+static uint32_t DecodeUtf8(const std::string& text, uint32_t& i)
+{
+    static constexpr uint32_t REPLACEMENT = 0xFFFD;
+
+    unsigned char lead = (unsigned char)text[i];
+    if (lead < 0x80)
+    {
+        i++;
+        return lead;
+    }
+
+    int length = 0;
+    uint32_t cp = 0;
+    if ((lead & 0xE0) == 0xC0)      { length = 2; cp = lead & 0x1F; }
+    else if ((lead & 0xF0) == 0xE0) { length = 3; cp = lead & 0x0F; }
+    else if ((lead & 0xF8) == 0xF0) { length = 4; cp = lead & 0x07; }
+    else
+    {
+        i++;
+        return REPLACEMENT;
+    }
+
+    if (i + length > text.size())
+    {
+        i++;
+        return REPLACEMENT;
+    }
+
+    for (int k = 1; k < length; k++)
+    {
+        unsigned char c = (unsigned char)text[i + k];
+        if ((c & 0xC0) != 0x80)
+        {
+            i++;
+            return REPLACEMENT;
+        }
+        cp = (cp << 6) | (c & 0x3F);
+    }
+
+    // Reject overlong encodings, surrogates and values past U+10FFFF
+    static constexpr uint32_t MIN_VALUE[5] = { 0, 0, 0x80, 0x800, 0x10000 };
+    if (cp < MIN_VALUE[length] || (cp >= 0xD800 && cp <= 0xDFFF) || cp > 0x10FFFF)
+    {
+        i++;
+        return REPLACEMENT;
+    }
+
+    i += length;
+    return cp;
+}
+
+// Close the line holding glyphs [first, end) and start a new one below it
+static void FinishLine(TextLayout& layout, uint32_t first, uint32_t end, uint32_t byteEnd, float lineAdvance)
+{
+    LayoutLine line;
+    line.FirstGlyph = first;
+    line.GlyphCount = end - first;
+    line.ByteBegin = first < layout.Glyphs.size() ? layout.Glyphs[first].ByteIndex : byteEnd;
+    line.ByteEnd = byteEnd;
+    line.LineTop = -(float)layout.Lines.size() * lineAdvance;
+
+    // Trailing spaces don't count towards the width (they are where the line wrapped)
+    uint32_t last = end;
+    while (last > first && layout.Glyphs[last - 1].Codepoint == ' ')
+        last--;
+
+    line.Width = 0.0f;
+    if (last > first)
+    {
+        const LayoutGlyph& g = layout.Glyphs[last - 1];
+        line.Width = g.Position.x + g.Advance;
+    }
+
+    layout.Lines.push_back(line);
+}
+
+static void BuildLayout(TextLayout& layout)
+{
+    const Font& font = *layout.LayoutFont;
+    const std::string& text = layout.Text;
+
+    float texelSize = font.GetTexelSize(layout.Params.Scale);
+    float lineAdvance = font.GetLineAdvance() * texelSize;
+    float maxWidth = layout.Params.MaxWidth;
+
+    layout.Glyphs.reserve(text.size());  // Upper bound: one glyph per byte
+
+    uint32_t lineStart = 0;
+    uint32_t breakGlyph = 0;  // First glyph after the last space on this line (0 = none)
+    float penX = 0.0f;
+
+    for (uint32_t i = 0; i < (uint32_t)text.size();)
+    {
+        uint32_t byteIndex = i;
+        uint32_t cp = DecodeUtf8(text, i);
+
+        if (cp == '\n')
+        {
+            FinishLine(layout, lineStart, (uint32_t)layout.Glyphs.size(), byteIndex, lineAdvance);
+            lineStart = (uint32_t)layout.Glyphs.size();
+            breakGlyph = 0;
+            penX = 0.0f;
+            continue;
+        }
+
+        const Glyph* glyph = font.GetGlyph(cp);
+        float advance = (glyph ? glyph->Advance : font.GetFallbackAdvance()) * texelSize;
+
+        // Word wrap: move everything after the last space to a new line,
+        // or break inside the word if it is wider than the whole line
+        uint32_t glyphCount = (uint32_t)layout.Glyphs.size();
+        if (maxWidth > 0.0f && cp != ' ' && penX + advance > maxWidth && glyphCount > lineStart)
+        {
+            uint32_t split = breakGlyph > lineStart ? breakGlyph : glyphCount;
+            uint32_t byteEnd = split < glyphCount ? layout.Glyphs[split].ByteIndex : byteIndex;
+
+            FinishLine(layout, lineStart, split, byteEnd, lineAdvance);
+
+            float shift = split < glyphCount ? layout.Glyphs[split].Position.x : penX;
+            for (uint32_t g = split; g < glyphCount; g++)
+                layout.Glyphs[g].Position.x -= shift;
+
+            penX -= shift;
+            lineStart = split;
+            breakGlyph = 0;
+        }
+
+        LayoutGlyph lg;
+        lg.Codepoint = cp;
+        lg.ByteIndex = byteIndex;
+        lg.Position = glm::vec2(penX, 0.0f);
+        lg.Advance = advance;
+        layout.Glyphs.push_back(lg);
+
+        penX += advance;
+        if (cp == ' ')
+            breakGlyph = (uint32_t)layout.Glyphs.size();
+    }
+
+    FinishLine(layout, lineStart, (uint32_t)layout.Glyphs.size(), (uint32_t)text.size(), lineAdvance);
+
+    // Apply alignment and baselines, and gather the bounds
+    glm::vec2 boundsMin(FLT_MAX);
+    glm::vec2 boundsMax(-FLT_MAX);
+
+    for (const LayoutLine& line : layout.Lines)
+    {
+        float offset = 0.0f;
+        if (layout.Params.Align == TextAlign::Center) offset = -line.Width * 0.5f;
+        else if (layout.Params.Align == TextAlign::Right) offset = -line.Width;
+
+        for (uint32_t g = line.FirstGlyph; g < line.FirstGlyph + line.GlyphCount; g++)
+        {
+            LayoutGlyph& lg = layout.Glyphs[g];
+            lg.Position.x += offset;
+            lg.Position.y = line.LineTop;
+
+            const Glyph* glyph = font.GetGlyph(lg.Codepoint);
+            if (!glyph || glyph->Size.x <= 0.0f || glyph->Size.y <= 0.0f)
+                continue;
+
+            glm::vec2 topLeft = lg.Position + glyph->Bearing * texelSize;
+            glm::vec2 size = glyph->Size * texelSize;
+
+            boundsMin = glm::min(boundsMin, glm::vec2(topLeft.x, topLeft.y - size.y));
+            boundsMax = glm::max(boundsMax, glm::vec2(topLeft.x + size.x, topLeft.y));
+        }
+
+        layout.Size.x = std::max(layout.Size.x, line.Width);
+    }
+
+    if (boundsMin.x > boundsMax.x)
+    {
+        boundsMin = glm::vec2(0.0f);
+        boundsMax = glm::vec2(0.0f);
+    }
+
+    layout.BoundsMin = boundsMin;
+    layout.BoundsMax = boundsMax;
+    layout.Size.y = ((layout.Lines.size() - 1) * font.GetLineAdvance() + font.GetLineHeight()) * texelSize;
+}
+
+bool TextLayout::Matches(std::string_view text, const TextLayoutParams& params, const Font* font) const
+{
+    return LayoutFont == font &&
+           Params.Scale == params.Scale &&
+           Params.Align == params.Align &&
+           Params.MaxWidth == params.MaxWidth &&
+           Text == text;
+}
+
+int TextLayout::HitTest(const glm::vec2& localPoint) const
+{
+    if (Lines.empty() || !LayoutFont) return -1;
+
+    float lineAdvance = LayoutFont->GetLineAdvance() * LayoutFont->GetTexelSize(Params.Scale);
+
+    // Lines are stacked downwards from the origin
+    float row = -localPoint.y / lineAdvance;
+    if (row < 0.0f || row >= (float)Lines.size()) return -1;
+
+    const LayoutLine& line = Lines[(size_t)row];
+
+    for (uint32_t g = line.FirstGlyph; g < line.FirstGlyph + line.GlyphCount; g++)
+    {
+        const LayoutGlyph& lg = Glyphs[g];
+        if (localPoint.x < lg.Position.x + lg.Advance * 0.5f)
+            return (int)lg.ByteIndex;
+    }
+
+    return (int)line.ByteEnd;
+}
+
+void TextLayoutCache::Init()
+{
+    s_Data = std::make_unique<CacheData>();
+}
+
+void TextLayoutCache::Shutdown()
+{
+    s_Data.reset();
+}
+
+uint64_t TextLayoutCache::ComputeKey(std::string_view text, const TextLayoutParams& params, const Font& font)
+{
+    uint64_t hash = HashBytes(text.data(), text.size());
+    hash = HashCombine(hash, params.Scale);
+    hash = HashCombine(hash, params.Align);
+    hash = HashCombine(hash, params.MaxWidth);
+    hash = HashCombine(hash, font.GetID());
+    return hash;
+}
+
+TextLayoutHandle TextLayoutCache::Get(std::string_view text, const TextLayoutParams& params)
+{
+    if (!s_Data) return nullptr;
+
+    const Font* font = params.LayoutFont ? params.LayoutFont : TextRenderer::GetActiveFont();
+    if (!font) return nullptr;
+
+    uint64_t key = ComputeKey(text, params, *font);
+
+    auto it = s_Data->Entries.find(key);
+    if (it != s_Data->Entries.end() && it->second->Matches(text, params, font))
+    {
+        it->second->LastUsedFrame = s_Data->FrameIndex;
+        return it->second;
+    }
+
+    // Miss (or hash collision): lay out once
+    auto layout = std::make_shared<TextLayout>();
+    layout->Text = std::string(text);
+    layout->Params = params;
+    layout->LayoutFont = font;
+    layout->Hash = key;
+    layout->LastUsedFrame = s_Data->FrameIndex;
+
+    BuildLayout(*layout);
+
+    s_Data->Entries[key] = layout;
+    return layout;
+}
+
+bool TextLayoutCache::BuildInto(std::string_view text, const TextLayoutParams& params, TextLayout& outLayout)
+{
+    const Font* font = params.LayoutFont ? params.LayoutFont : TextRenderer::GetActiveFont();
+    if (!font) return false;
+
+    // clear()/assign() keep the capacity from earlier calls
+    outLayout.Text.assign(text.data(), text.size());
+    outLayout.Params = params;
+    outLayout.LayoutFont = font;
+    outLayout.Hash = 0;  // Never looked up
+    outLayout.Glyphs.clear();
+    outLayout.Lines.clear();
+    outLayout.Size = glm::vec2(0.0f);
+
+    BuildLayout(outLayout);
+    return true;
+}
+
+void TextLayoutCache::NewFrame()
+{
+    if (!s_Data) return;
+
+    s_Data->FrameIndex++;
+
+    for (auto it = s_Data->Entries.begin(); it != s_Data->Entries.end();)
+    {
+        if (s_Data->FrameIndex - it->second->LastUsedFrame > s_Data->EvictAfterFrames)
+            it = s_Data->Entries.erase(it);
+        else
+            ++it;
+    }
+}
+
+size_t TextLayoutCache::GetEntryCount()
+{
+    return s_Data ? s_Data->Entries.size() : 0;
+}
+
+void TextLayoutCache::Clear()
+{
+    if (s_Data) s_Data->Entries.clear();
+}
@@ -1,15 +1,77 @@
 #include "Graphics/TextRenderer.h"
+#include "Graphics/TextCache.h"
+#include "Graphics/Font.h"
 #include "Graphics/Shader.h"
 #include "Graphics/Renderer.h"
 #include <glad/glad.h>
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdarg>
+#include <cstdio>
+#include <cstring>
 #include <iostream>
 
 // Simple bitmap font using 8x8 pixel characters
 // This creates a basic font without needing external files
 
+// Glyphs are packed into a single-channel atlas, one 6x8 cell per character
+static constexpr int GLYPH_COLS = 5;
+static constexpr int GLYPH_ROWS = 7;
+static constexpr int ATLAS_CELL_W = 6;
+static constexpr int ATLAS_CELL_H = 8;
+static constexpr int ATLAS_CELLS_PER_ROW = 16;
+static constexpr int ATLAS_WIDTH = ATLAS_CELL_W * ATLAS_CELLS_PER_ROW;
+static constexpr int ATLAS_HEIGHT = ATLAS_CELL_H * 6;
+
+// Initial size of the streaming buffer behind RenderTextf/RenderNumber (grows for longer strings)
+static constexpr int STREAM_BUFFER_VERTICES = 16384;
+
+// A glyph resolved while tessellating, before quads are grouped by page
+struct PlacedGlyph
+{
+    glm::vec2 Pen;
+    Glyph Metrics;
+    uint32_t Generation;  // Page generation the glyph was placed under
+    uint32_t Order;       // Position in the layout, keeps the sort stable without a temporary buffer
+};
+
 struct TextRenderer::TextData
 {
     bool IsInitialized = false;
+
+    std::unique_ptr<Shader> TextShader;
+
+    // Uniform locations, looked up once so drawing a mesh doesn't query them by name
+    struct
+    {
+        int ViewProjection = -1;
+        int Offset = -1;
+        int Color = -1;
+        int TexelSize = -1;
+        int IsSDF = -1;
+        int DistanceScale = -1;
+        int Margin = -1;
+        int OutlineWidth = -1;
+        int OutlineColor = -1;
+        int ShadowOffset = -1;
+        int ShadowColor = -1;
+    } Uniforms;
+
+    std::unique_ptr<Font> BuiltinFont;
+    std::map<std::string, std::unique_ptr<Font>> LoadedFonts;  // Keyed by path + size
+    Font* ActiveFont = nullptr;
+
+    std::vector<PlacedGlyph> PlacedScratch;  // Reused by BuildTextVertices
+
+    // RenderTextf/RenderNumber reuse one layout, vertex list and mesh, and append their
+    // vertices to a shared buffer that is orphaned when it fills up
+    std::shared_ptr<TextLayout> StreamLayout;
+    std::vector<TextVertex> StreamVertices;
+    TextMesh StreamMesh;
+    int StreamCapacity = 0;  // Vertices
+    int StreamOffset = 0;
 };
 
 std::unique_ptr<TextRenderer::TextData> TextRenderer::s_Data = nullptr;
@@ -209,103 +271,421 @@ static const unsigned char FONT_DATA[95][7] = {
     {0x00, 0x00, 0x08, 0x15, 0x02, 0x00, 0x00}
 };
 
+static std::unique_ptr<Font> CreateBuiltinFont()
+{
+    std::vector<unsigned char> pixels(ATLAS_WIDTH * ATLAS_HEIGHT, 0);
+
+    // One font pixel is 2 world units at scale 1.0
+    auto font = std::make_unique<Font>(FontType::Bitmap, 2.0f);
+
+    for (int glyph = 0; glyph < 95; glyph++)
+    {
+        int cellX = (glyph % ATLAS_CELLS_PER_ROW) * ATLAS_CELL_W;
+        int cellY = (glyph / ATLAS_CELLS_PER_ROW) * ATLAS_CELL_H;
+
+        for (int row = 0; row < GLYPH_ROWS; row++)
+        {
+            unsigned char rowData = FONT_DATA[glyph][row];
+
+            for (int col = 0; col < GLYPH_COLS; col++)
+            {
+                if (rowData & (1 << (4 - col)))  // Check if bit is set
+                    pixels[(cellY + row) * ATLAS_WIDTH + cellX + col] = 255;
+            }
+        }
+
+        // Font pixels are centered on the pen grid, so the glyph starts half a pixel up/left
+        Glyph g;
+        g.Advance = (float)ATLAS_CELL_W;  // 5 pixels + 1 pixel spacing
+        if (glyph != 0)  // Space has nothing to draw
+        {
+            g.Size = glm::vec2((float)GLYPH_COLS, (float)GLYPH_ROWS);
+            g.Bearing = glm::vec2(-0.5f, 0.5f);
+            g.AtlasRect = glm::vec4((float)cellX, (float)cellY, (float)(cellX + GLYPH_COLS), (float)(cellY + GLYPH_ROWS));
+        }
+        font->AddGlyph((uint32_t)(glyph + 32), g);
+    }
+
+    font->SetAtlas(pixels.data(), ATLAS_WIDTH, ATLAS_HEIGHT);
+    font->SetLineMetrics((float)GLYPH_ROWS, (float)ATLAS_CELL_H);
+    font->SetFallbackAdvance((float)ATLAS_CELL_W);
+    return font;
+}
+
 void TextRenderer::Init()
 {
     s_Data = std::make_unique<TextData>();
+
+    s_Data->BuiltinFont = CreateBuiltinFont();
+    s_Data->ActiveFont = s_Data->BuiltinFont.get();
+
+    s_Data->TextShader = std::make_unique<Shader>(
+        "assets/shaders/text.vert",
+        "assets/shaders/text.frag"
+    );
+
+    s_Data->TextShader->Bind();
+    s_Data->TextShader->SetInt("u_FontAtlas", 0);
+    s_Data->TextShader->Unbind();
+
+    unsigned int program = s_Data->TextShader->GetID();
+    auto& u = s_Data->Uniforms;
+    u.ViewProjection = glGetUniformLocation(program, "u_ViewProjection");
+    u.Offset = glGetUniformLocation(program, "u_Offset");
+    u.Color = glGetUniformLocation(program, "u_Color");
+    u.TexelSize = glGetUniformLocation(program, "u_TexelSize");
+    u.IsSDF = glGetUniformLocation(program, "u_IsSDF");
+    u.DistanceScale = glGetUniformLocation(program, "u_DistanceScale");
+    u.Margin = glGetUniformLocation(program, "u_Margin");
+    u.OutlineWidth = glGetUniformLocation(program, "u_OutlineWidth");
+    u.OutlineColor = glGetUniformLocation(program, "u_OutlineColor");
+    u.ShadowOffset = glGetUniformLocation(program, "u_ShadowOffset");
+    u.ShadowColor = glGetUniformLocation(program, "u_ShadowColor");
+
+    // Streamed strings never exceed the format buffer, so reserving for it up front
+    // means the scratch storage doesn't grow as values get longer
+    s_Data->StreamLayout = std::make_shared<TextLayout>();
+    s_Data->StreamLayout->Text.reserve(FORMAT_BUFFER_SIZE);
+    s_Data->StreamLayout->Glyphs.reserve(FORMAT_BUFFER_SIZE);
+    s_Data->StreamLayout->Lines.reserve(FORMAT_BUFFER_SIZE);
+    s_Data->StreamVertices.reserve(FORMAT_BUFFER_SIZE * 6);
+    s_Data->PlacedScratch.reserve(FORMAT_BUFFER_SIZE);
+    s_Data->StreamMesh.Ranges.reserve(8);
+    s_Data->StreamMesh.Layout = s_Data->StreamLayout;
+    s_Data->StreamCapacity = STREAM_BUFFER_VERTICES;
+
+    TextMesh& stream = s_Data->StreamMesh;
+    glGenVertexArrays(1, &stream.VAO);
+    glGenBuffers(1, &stream.VBO);
+    glBindVertexArray(stream.VAO);
+    glBindBuffer(GL_ARRAY_BUFFER, stream.VBO);
+    glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)s_Data->StreamCapacity * sizeof(TextVertex), nullptr, GL_STREAM_DRAW);
+    SetVertexAttributes();
+    glBindVertexArray(0);
+
     s_Data->IsInitialized = true;
     std::cout << "TextRenderer initialized with built-in bitmap font\n";
 }
 
 void TextRenderer::Shutdown()
 {
+    if (s_Data)
+    {
+        // TextCache is already shut down, so the mesh destructor won't release these
+        TextMesh& stream = s_Data->StreamMesh;
+        if (stream.VBO) glDeleteBuffers(1, &stream.VBO);
+        if (stream.VAO) glDeleteVertexArrays(1, &stream.VAO);
+        stream.VBO = 0;
+        stream.VAO = 0;
+    }
+
     s_Data.reset();
 }
 
 bool TextRenderer::LoadFont(const std::string& fontPath, unsigned int fontSize)
 {
-    // Using built-in bitmap font, no need to load
+    if (!s_Data) return false;
+
+    std::string key = fontPath + "@" + std::to_string(fontSize);
+
+    auto it = s_Data->LoadedFonts.find(key);
+    if (it == s_Data->LoadedFonts.end())
+    {
+        std::unique_ptr<Font> font = Font::LoadTTF(fontPath, fontSize);
+        if (!font)
+            return false;  // Keep whatever font was active
+
+        it = s_Data->LoadedFonts.emplace(key, std::move(font)).first;
+    }
+
+    s_Data->ActiveFont = it->second.get();
     return true;
 }
 
-void TextRenderer::RenderText(const std::string& text, glm::vec2 position, float scale, glm::vec4 color)
+void TextRenderer::SetActiveFont(Font* font)
+{
+    if (!s_Data) return;
+    s_Data->ActiveFont = font ? font : s_Data->BuiltinFont.get();
+}
+
+Font* TextRenderer::GetActiveFont()
+{
+    return s_Data ? s_Data->ActiveFont : nullptr;
+}
+
+Font* TextRenderer::GetBuiltinFont()
+{
+    return s_Data ? s_Data->BuiltinFont.get() : nullptr;
+}
+
+void TextRenderer::RenderText(std::string_view text, glm::vec2 position, float scale, glm::vec4 color,
+                              const TextEffects& effects)
+{
+    if (!s_Data || !s_Data->IsInitialized)
+    {
+        return;
+    }
+
+    TextMeshHandle mesh = TextCache::Get(text, scale, color);
+    if (mesh)
+        RenderText(*mesh, position, effects);
+}
+
+void TextRenderer::RenderText(std::string_view text, glm::vec2 position, const TextLayoutParams& params,
+                              glm::vec4 color, const TextEffects& effects)
+{
+    if (!s_Data || !s_Data->IsInitialized)
+    {
+        return;
+    }
+
+    TextMeshHandle mesh = TextCache::Get(text, params, color);
+    if (mesh)
+        RenderText(*mesh, position, effects);
+}
+
+// Write "<label><value>" into buffer and return a view of it (truncates the label if needed)
+static std::string_view FormatNumber(char* buffer, size_t size, std::string_view label, long long value)
+{
+    // Leave room for the longest 64-bit value ("-9223372036854775808")
+    size_t labelLength = std::min(label.size(), size - 20);
+    std::memcpy(buffer, label.data(), labelLength);
+
+    std::to_chars_result result = std::to_chars(buffer + labelLength, buffer + size, value);
+    return std::string_view(buffer, result.ptr - buffer);
+}
+
+// vsnprintf into buffer and return a view of what fits
+static std::string_view FormatText(char* buffer, size_t size, const char* format, va_list args)
+{
+    int length = std::vsnprintf(buffer, size, format, args);
+    if (length < 0) return std::string_view();
+
+    return std::string_view(buffer, std::min((size_t)length, size - 1));
+}
+
+void TextRenderer::RenderTextf(glm::vec2 position, float scale, glm::vec4 color, const char* format, ...)
+{
+    char buffer[FORMAT_BUFFER_SIZE];
+
+    va_list args;
+    va_start(args, format);
+    std::string_view text = FormatText(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    RenderStreamedText(text, position, TextLayoutParams(scale), color, TextEffects());
+}
+
+void TextRenderer::RenderTextf(glm::vec2 position, const TextLayoutParams& params, glm::vec4 color, const char* format, ...)
+{
+    char buffer[FORMAT_BUFFER_SIZE];
+
+    va_list args;
+    va_start(args, format);
+    std::string_view text = FormatText(buffer, sizeof(buffer), format, args);
+    va_end(args);
+
+    RenderStreamedText(text, position, params, color, TextEffects());
+}
+
+void TextRenderer::RenderNumber(std::string_view label, long long value, glm::vec2 position, float scale,
+                                glm::vec4 color, const TextEffects& effects)
+{
+    char buffer[FORMAT_BUFFER_SIZE];
+    RenderStreamedText(FormatNumber(buffer, sizeof(buffer), label, value), position, TextLayoutParams(scale), color, effects);
+}
+
+void TextRenderer::RenderNumber(std::string_view label, long long value, glm::vec2 position,
+                                const TextLayoutParams& params, glm::vec4 color, const TextEffects& effects)
+{
+    char buffer[FORMAT_BUFFER_SIZE];
+    RenderStreamedText(FormatNumber(buffer, sizeof(buffer), label, value), position, params, color, effects);
+}
+
+void TextRenderer::RenderStreamedText(std::string_view text, glm::vec2 position, const TextLayoutParams& params,
+                                      glm::vec4 color, const TextEffects& effects)
 {
     if (!s_Data || !s_Data->IsInitialized)
     {
         return;
     }
 
-    float pixelSize = 2.0f * scale;  // Size of each pixel in the font
-    float charWidth = 6.0f * pixelSize;  // 5 pixels + 1 pixel spacing
-    float charHeight = 7.0f * pixelSize;
+    TextLayout& layout = *s_Data->StreamLayout;
+    if (!TextLayoutCache::BuildInto(text, params, layout))
+        return;
+
+    TextMesh& mesh = s_Data->StreamMesh;
+    std::vector<TextVertex>& vertices = s_Data->StreamVertices;
+
+    vertices.clear();
+    BuildTextVertices(layout, vertices, mesh);
 
-    glm::vec2 currentPos = position;
+    int count = (int)vertices.size();
+    mesh.VertexCount = count;
+    mesh.Color = color;
+    if (count == 0) return;
 
-    for (char c : text)
+    // Append behind what earlier calls wrote. When the buffer is full, orphan it so the
+    // driver hands out fresh storage instead of waiting for draws still reading the old one
+    glBindBuffer(GL_ARRAY_BUFFER, mesh.VBO);
+    if (s_Data->StreamOffset + count > s_Data->StreamCapacity)
     {
-        if (c == ' ')
-        {
-            currentPos.x += charWidth;
-            continue;
-        }
+        s_Data->StreamCapacity = std::max(s_Data->StreamCapacity, count);
+        s_Data->StreamOffset = 0;
+        glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)s_Data->StreamCapacity * sizeof(TextVertex), nullptr, GL_STREAM_DRAW);
+    }
+    glBufferSubData(GL_ARRAY_BUFFER, (GLintptr)s_Data->StreamOffset * sizeof(TextVertex),
+                    (GLsizeiptr)count * sizeof(TextVertex), vertices.data());
 
-        if (c == '\n')
-        {
-            currentPos.x = position.x;
-            currentPos.y -= charHeight + pixelSize;
-            continue;
-        }
+    for (TextMeshRange& range : mesh.Ranges)
+        range.FirstVertex += s_Data->StreamOffset;
+    s_Data->StreamOffset += count;
 
-        // Get character index (ASCII 32-126)
-        int charIndex = (int)c - 32;
-        if (charIndex < 0 || charIndex >= 95)
-        {
-            currentPos.x += charWidth;
-            continue;
-        }
+    RenderText(mesh, position, effects);
+}
 
-        // Draw each pixel of the character
-        for (int row = 0; row < 7; row++)
-        {
-            unsigned char rowData = FONT_DATA[charIndex][row];
+void TextRenderer::RenderText(const TextMesh& mesh, glm::vec2 position, const TextEffects& effects)
+{
+    if (!s_Data || !s_Data->IsInitialized)
+    {
+        return;
+    }
 
-            for (int col = 0; col < 5; col++)
-            {
-                if (rowData & (1 << (4 - col)))  // Check if bit is set
-                {
-                    glm::vec2 pixelPos;
-                    pixelPos.x = currentPos.x + col * pixelSize;
-                    pixelPos.y = currentPos.y - row * pixelSize;
+    mesh.LastUsedFrame = TextCache::GetFrameIndex();
+    if (mesh.VertexCount == 0 || !mesh.Layout) return;
 
-                    Renderer::DrawQuad(pixelPos, glm::vec2(pixelSize, pixelSize), color);
-                }
-            }
-        }
+    const Font& font = *mesh.Layout->LayoutFont;
+
+    const auto& u = s_Data->Uniforms;
 
-        currentPos.x += charWidth;
+    s_Data->TextShader->Bind();
+    glUniformMatrix4fv(u.ViewProjection, 1, GL_FALSE, &Renderer::GetViewProjectionMatrix()[0][0]);
+    glUniform2f(u.Offset, position.x, position.y);
+    glUniform4fv(u.Color, 1, &mesh.Color[0]);
+    glUniform1f(u.TexelSize, mesh.TexelSize);
+    glUniform1i(u.IsSDF, font.GetType() == FontType::SDF ? 1 : 0);
+    glUniform1f(u.DistanceScale, font.GetDistanceScale());
+
+    // Grow every glyph quad far enough to hold the outline and the shadow
+    float outlineWidth = std::max(effects.OutlineWidth, 0.0f);
+    float margin = outlineWidth + std::max(std::abs(effects.ShadowOffset.x), std::abs(effects.ShadowOffset.y));
+
+    glUniform1f(u.Margin, margin);
+    glUniform1f(u.OutlineWidth, outlineWidth);
+    glUniform4fv(u.OutlineColor, 1, &effects.OutlineColor[0]);
+    glUniform2f(u.ShadowOffset, effects.ShadowOffset.x, effects.ShadowOffset.y);
+    glUniform4fv(u.ShadowColor, 1, &effects.ShadowColor[0]);
+
+    glActiveTexture(GL_TEXTURE0);
+    glBindVertexArray(mesh.VAO);
+
+    // One draw per atlas page; ranges whose page was evicted are skipped until rebuilt
+    for (const TextMeshRange& range : mesh.Ranges)
+    {
+        if (font.GetPageGeneration(range.Page) != range.Generation)
+            continue;
+
+        font.TouchPage(range.Page);
+        glBindTexture(GL_TEXTURE_2D, font.GetPageTexture(range.Page));
+        glDrawArrays(GL_TRIANGLES, range.FirstVertex, range.VertexCount);
     }
+
+    glBindVertexArray(0);
+
+    // Hand the pipeline back to the quad renderer
+    Renderer::BindQuadShader();
 }
 
-float TextRenderer::GetTextWidth(const std::string& text, float scale)
+void TextRenderer::BuildTextVertices(const TextLayout& layout, std::vector<TextVertex>& outVertices, TextMesh& outMesh)
 {
-    float pixelSize = 2.0f * scale;
-    float charWidth = 6.0f * pixelSize;
+    if (!s_Data) return;
+
+    const Font& font = *layout.LayoutFont;
+    float texelSize = font.GetTexelSize(layout.Params.Scale);  // World size of one atlas texel
 
-    int lineLength = 0;
-    int maxLength = 0;
+    // Resolve every glyph first (this may rasterize into dynamic pages), remembering the
+    // page generation each one was placed under
+    std::vector<PlacedGlyph>& placed = s_Data->PlacedScratch;
+    placed.clear();
 
-    for (char c : text)
+    for (const LayoutGlyph& lg : layout.Glyphs)
     {
-        if (c == '\n')
-        {
-            maxLength = std::max(maxLength, lineLength);
-            lineLength = 0;
-        }
-        else
-        {
-            lineLength++;
-        }
+        const Glyph* glyph = font.GetGlyph(lg.Codepoint);
+        if (!glyph || glyph->Size.x <= 0.0f || glyph->Size.y <= 0.0f)
+            continue;
+
+        placed.push_back({ lg.Position, *glyph, font.GetPageGeneration(glyph->Page), (uint32_t)placed.size() });
     }
 
-    maxLength = std::max(maxLength, lineLength);
-    return maxLength * charWidth;
-}
\ No newline at end of file
+    // Group quads by page so each page is one draw call, keeping layout order within a page
+    // (std::stable_sort would allocate a temporary buffer)
+    std::sort(placed.begin(), placed.end(), [](const PlacedGlyph& a, const PlacedGlyph& b)
+    {
+        return a.Metrics.Page != b.Metrics.Page ? a.Metrics.Page < b.Metrics.Page : a.Order < b.Order;
+    });
+
+    outVertices.reserve(placed.size() * 6);
+    outMesh.Ranges.clear();
+
+    for (const PlacedGlyph& pg : placed)
+    {
+        const Glyph& glyph = pg.Metrics;
+
+        if (outMesh.Ranges.empty() || outMesh.Ranges.back().Page != glyph.Page)
+            outMesh.Ranges.push_back({ glyph.Page, font.GetPageGeneration(glyph.Page), (int)outVertices.size(), 0 });
+
+        // A page evicted while this mesh was being built leaves the range stale,
+        // so the cache rebuilds it on next use
+        TextMeshRange& range = outMesh.Ranges.back();
+        if (pg.Generation != range.Generation)
+            range.Generation = UINT32_MAX;
+
+        float x0 = pg.Pen.x + glyph.Bearing.x * texelSize;
+        float x1 = x0 + glyph.Size.x * texelSize;
+        float y0 = pg.Pen.y + glyph.Bearing.y * texelSize;
+        float y1 = y0 - glyph.Size.y * texelSize;
+
+        // Atlas texel coordinates (atlas rows run top-down)
+        const glm::vec4& rect = glyph.AtlasRect;
+        float u0 = rect.x, v0 = rect.y, u1 = rect.z, v1 = rect.w;
+
+        outVertices.push_back({ glm::vec2(x0, y1), glm::vec2(u0, v1), rect, glm::vec2(-1.0f, -1.0f) });
+        outVertices.push_back({ glm::vec2(x1, y1), glm::vec2(u1, v1), rect, glm::vec2( 1.0f, -1.0f) });
+        outVertices.push_back({ glm::vec2(x1, y0), glm::vec2(u1, v0), rect, glm::vec2( 1.0f,  1.0f) });
+
+        outVertices.push_back({ glm::vec2(x1, y0), glm::vec2(u1, v0), rect, glm::vec2( 1.0f,  1.0f) });
+        outVertices.push_back({ glm::vec2(x0, y0), glm::vec2(u0, v0), rect, glm::vec2(-1.0f,  1.0f) });
+        outVertices.push_back({ glm::vec2(x0, y1), glm::vec2(u0, v1), rect, glm::vec2(-1.0f, -1.0f) });
+
+        range.VertexCount += 6;
+    }
+
+    outMesh.Size = layout.Size;
+    outMesh.TexelSize = texelSize;
+}
+
+void TextRenderer::SetVertexAttributes()
+{
+    // Position attribute
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(TextVertex), (void*)offsetof(TextVertex, Position));
+
+    // Atlas coordinate attribute
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(TextVertex), (void*)offsetof(TextVertex, TexCoord));
+
+    // Glyph bounds attribute (keeps effect sampling inside the glyph's cell)
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(TextVertex), (void*)offsetof(TextVertex, GlyphRect));
+
+    // Corner attribute
+    glEnableVertexAttribArray(3);
+    glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(TextVertex), (void*)offsetof(TextVertex, Corner));
+}
+
+float TextRenderer::GetTextWidth(std::string_view text, float scale, const Font* font)
+{
+    // Measured once per distinct string, then served from the layout cache
+    TextLayoutHandle layout = TextLayoutCache::Get(text, TextLayoutParams(scale, TextAlign::Left, 0.0f, font));
+    return layout ? layout->Size.x : 0.0f;
+}
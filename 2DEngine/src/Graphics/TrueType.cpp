@@ -0,0 +1,630 @@
+#include "Graphics/TrueType.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+// Simple glyph point flags
+static constexpr uint8_t FLAG_ON_CURVE = 0x01;
+static constexpr uint8_t FLAG_X_SHORT = 0x02;
+static constexpr uint8_t FLAG_Y_SHORT = 0x04;
+static constexpr uint8_t FLAG_REPEAT = 0x08;
+static constexpr uint8_t FLAG_X_SAME_OR_POSITIVE = 0x10;
+static constexpr uint8_t FLAG_Y_SAME_OR_POSITIVE = 0x20;
+
+// Compound glyph component flags
+static constexpr uint16_t COMPONENT_ARGS_ARE_WORDS = 0x0001;
+static constexpr uint16_t COMPONENT_ARGS_ARE_XY = 0x0002;
+static constexpr uint16_t COMPONENT_SCALE = 0x0008;
+static constexpr uint16_t COMPONENT_MORE = 0x0020;
+static constexpr uint16_t COMPONENT_XY_SCALE = 0x0040;
+static constexpr uint16_t COMPONENT_TWO_BY_TWO = 0x0080;
+
+// Compound glyphs rarely nest more than twice or use more than a handful of parts;
+// the limits stop damaged fonts from expanding reference cycles
+static constexpr int MAX_COMPONENT_DEPTH = 8;
+static constexpr int MAX_COMPONENTS = 256;
+
+// Larger glyphs are rejected (they'd never fit an atlas page anyway)
+static constexpr int MAX_GLYPH_TEXELS = 1024;
+
+// Curves are split into at most this many lines
+static constexpr int MAX_CURVE_SEGMENTS = 32;
+
+TrueTypeFont::TrueTypeFont()
+    : m_Data(nullptr)
+    , m_Size(0)
+    , m_Directory(0)
+    , m_Glyf(0)
+    , m_GlyfLength(0)
+    , m_Loca(0)
+    , m_Hmtx(0)
+    , m_Cmap(0)
+    , m_CmapFormat(0)
+    , m_LongLoca(false)
+    , m_GlyphCount(0)
+    , m_HMetricCount(0)
+    , m_Ascent(0)
+    , m_Descent(0)
+    , m_LineGap(0)
+{
+}
+
+// ============================================
+// Reading
+// ============================================
+
+uint8_t TrueTypeFont::ReadU8(size_t offset) const
+{
+    return offset < m_Size ? m_Data[offset] : 0;
+}
+
+uint16_t TrueTypeFont::ReadU16(size_t offset) const
+{
+    if (m_Size < 2 || offset > m_Size - 2) return 0;
+    return (uint16_t)((m_Data[offset] << 8) | m_Data[offset + 1]);
+}
+
+uint32_t TrueTypeFont::ReadU32(size_t offset) const
+{
+    if (m_Size < 4 || offset > m_Size - 4) return 0;
+    return ((uint32_t)m_Data[offset] << 24) | ((uint32_t)m_Data[offset + 1] << 16) |
+           ((uint32_t)m_Data[offset + 2] << 8) | (uint32_t)m_Data[offset + 3];
+}
+
+bool TrueTypeFont::FindTable(const char* tag, size_t& outOffset, size_t& outLength) const
+{
+    uint16_t tableCount = ReadU16(m_Directory + 4);
+    for (uint16_t i = 0; i < tableCount; i++)
+    {
+        size_t record = m_Directory + 12 + (size_t)i * 16;
+        if (record + 16 > m_Size) return false;
+        if (std::memcmp(m_Data + record, tag, 4) != 0) continue;
+
+        size_t offset = ReadU32(record + 8);
+        size_t length = ReadU32(record + 12);
+        if (offset > m_Size || length > m_Size - offset) return false;
+
+        outOffset = offset;
+        outLength = length;
+        return true;
+    }
+    return false;
+}
+
+bool TrueTypeFont::Init(const unsigned char* data, size_t size)
+{
+    *this = TrueTypeFont();
+    m_Data = data;
+    m_Size = size;
+
+    if (!data || size < 12) return false;
+
+    // Collections list their fonts' directories; take the first
+    if (std::memcmp(data, "ttcf", 4) == 0)
+        m_Directory = ReadU32(12);
+
+    if (m_Directory > size - 12) return false;
+
+    // 1.0 or 'true'; anything else (e.g. 'OTTO') has no TrueType outlines
+    uint32_t version = ReadU32(m_Directory);
+    if (version != 0x00010000 && version != 0x74727565)
+        return false;
+
+    size_t head, headLength, hhea, hheaLength, maxp, maxpLength;
+    size_t loca, locaLength, hmtx, hmtxLength, cmap, cmapLength;
+    if (!FindTable("head", head, headLength) || headLength < 54 ||
+        !FindTable("hhea", hhea, hheaLength) || hheaLength < 36 ||
+        !FindTable("maxp", maxp, maxpLength) || maxpLength < 6 ||
+        !FindTable("loca", loca, locaLength) ||
+        !FindTable("hmtx", hmtx, hmtxLength) ||
+        !FindTable("cmap", cmap, cmapLength) ||
+        !FindTable("glyf", m_Glyf, m_GlyfLength))
+        return false;
+
+    m_Loca = loca;
+    m_Hmtx = hmtx;
+    m_LongLoca = ReadI16(head + 50) != 0;
+    m_GlyphCount = ReadU16(maxp + 4);
+    m_HMetricCount = std::min<uint32_t>(ReadU16(hhea + 34), m_GlyphCount);
+
+    m_Ascent = ReadI16(hhea + 4);
+    m_Descent = ReadI16(hhea + 6);
+    m_LineGap = ReadI16(hhea + 8);
+
+    if (m_GlyphCount == 0 || m_HMetricCount == 0 || m_Ascent <= m_Descent)
+        return false;
+    if ((size_t)(m_GlyphCount + 1) * (m_LongLoca ? 4 : 2) > locaLength)
+        return false;
+    if ((size_t)m_HMetricCount * 4 + (size_t)(m_GlyphCount - m_HMetricCount) * 2 > hmtxLength)
+        return false;
+
+    // Prefer the full Unicode map (format 12) over the BMP-only one (format 4)
+    int bestRank = 0;
+    uint16_t encodingCount = ReadU16(cmap + 2);
+    for (uint16_t i = 0; i < encodingCount; i++)
+    {
+        size_t record = cmap + 4 + (size_t)i * 8;
+        uint16_t platform = ReadU16(record);
+        uint16_t encoding = ReadU16(record + 2);
+        size_t offset = ReadU32(record + 4);
+        if (offset >= cmapLength) continue;
+
+        bool unicode = platform == 0 || (platform == 3 && (encoding == 1 || encoding == 10));
+        if (!unicode) continue;
+
+        uint16_t format = ReadU16(cmap + offset);
+        int rank = (format == 12) ? 2 : (format == 4) ? 1 : 0;
+        if (rank > bestRank)
+        {
+            bestRank = rank;
+            m_Cmap = cmap + offset;
+            m_CmapFormat = format;
+        }
+    }
+
+    return bestRank > 0;
+}
+
+// ============================================
+// Metrics
+// ============================================
+
+float TrueTypeFont::ScaleForPixelHeight(float pixels) const
+{
+    int height = m_Ascent - m_Descent;
+    return height > 0 ? pixels / (float)height : 0.0f;
+}
+
+uint32_t TrueTypeFont::FindGlyphIndex(uint32_t codepoint) const
+{
+    uint32_t glyph = 0;
+
+    if (m_CmapFormat == 4)
+    {
+        if (codepoint > 0xFFFF) return 0;
+
+        // Segments sorted by end code: find the first one ending at or after the codepoint
+        uint32_t segments = ReadU16(m_Cmap + 6) / 2;
+        size_t endCodes = m_Cmap + 14;
+        size_t startCodes = endCodes + segments * 2 + 2;
+        size_t deltas = startCodes + segments * 2;
+        size_t rangeOffsets = deltas + segments * 2;
+
+        uint32_t low = 0, high = segments;
+        while (low < high)
+        {
+            uint32_t mid = (low + high) / 2;
+            if (ReadU16(endCodes + mid * 2) < codepoint)
+                low = mid + 1;
+            else
+                high = mid;
+        }
+        if (low == segments) return 0;
+
+        uint16_t start = ReadU16(startCodes + low * 2);
+        if (codepoint < start) return 0;
+
+        uint16_t delta = ReadU16(deltas + low * 2);
+        uint16_t rangeOffset = ReadU16(rangeOffsets + low * 2);
+        if (rangeOffset == 0)
+        {
+            glyph = (codepoint + delta) & 0xFFFF;
+        }
+        else
+        {
+            // Offset is relative to the rangeOffset entry itself
+            glyph = ReadU16(rangeOffsets + low * 2 + rangeOffset + (codepoint - start) * 2);
+            if (glyph != 0)
+                glyph = (glyph + delta) & 0xFFFF;
+        }
+    }
+    else if (m_CmapFormat == 12)
+    {
+        uint32_t groups = ReadU32(m_Cmap + 12);
+        uint32_t low = 0, high = groups;
+        while (low < high)
+        {
+            uint32_t mid = low + (high - low) / 2;
+            size_t group = m_Cmap + 16 + (size_t)mid * 12;
+            if (codepoint < ReadU32(group))
+                high = mid;
+            else if (codepoint > ReadU32(group + 4))
+                low = mid + 1;
+            else
+            {
+                glyph = ReadU32(group + 8) + (codepoint - ReadU32(group));
+                break;
+            }
+        }
+    }
+
+    return glyph < m_GlyphCount ? glyph : 0;
+}
+
+void TrueTypeFont::GetGlyphHMetrics(uint32_t glyph, int& outAdvance, int& outLeftBearing) const
+{
+    outAdvance = outLeftBearing = 0;
+    if (glyph >= m_GlyphCount) return;
+
+    // Glyphs past the last full record share its advance (monospaced tails)
+    if (glyph < m_HMetricCount)
+    {
+        outAdvance = ReadU16(m_Hmtx + (size_t)glyph * 4);
+        outLeftBearing = ReadI16(m_Hmtx + (size_t)glyph * 4 + 2);
+    }
+    else
+    {
+        outAdvance = ReadU16(m_Hmtx + (size_t)(m_HMetricCount - 1) * 4);
+        outLeftBearing = ReadI16(m_Hmtx + (size_t)m_HMetricCount * 4 + (size_t)(glyph - m_HMetricCount) * 2);
+    }
+}
+
+// ============================================
+// Outlines
+// ============================================
+
+bool TrueTypeFont::GetGlyphRange(uint32_t glyph, size_t& outOffset, size_t& outLength) const
+{
+    if (glyph >= m_GlyphCount) return false;
+
+    size_t start, end;
+    if (m_LongLoca)
+    {
+        start = ReadU32(m_Loca + (size_t)glyph * 4);
+        end = ReadU32(m_Loca + (size_t)glyph * 4 + 4);
+    }
+    else
+    {
+        start = (size_t)ReadU16(m_Loca + (size_t)glyph * 2) * 2;
+        end = (size_t)ReadU16(m_Loca + (size_t)glyph * 2 + 2) * 2;
+    }
+
+    // Equal offsets mean no outline (whitespace)
+    if (end <= start || end > m_GlyfLength) return false;
+
+    outOffset = m_Glyf + start;
+    outLength = end - start;
+    return true;
+}
+
+static float ReadF2Dot14(int16_t value)
+{
+    return value / 16384.0f;
+}
+
+bool TrueTypeFont::AppendOutline(uint32_t glyph, const Transform& transform, float tolerance, int depth,
+                                 int& componentBudget, std::vector<std::vector<Point>>& contours) const
+{
+    if (depth > MAX_COMPONENT_DEPTH) return false;
+
+    size_t offset, length;
+    if (!GetGlyphRange(glyph, offset, length)) return true;  // Nothing to draw
+    if (length < 10) return false;
+
+    size_t end = offset + length;
+    int16_t contourCount = ReadI16(offset);
+    size_t pos = offset + 10;
+
+    if (contourCount < 0)
+    {
+        // Compound: other glyphs placed by an offset and an optional 2x2 matrix
+        uint16_t flags;
+        do
+        {
+            if (pos + 4 > end || --componentBudget < 0) return false;
+            flags = ReadU16(pos);
+            uint16_t component = ReadU16(pos + 2);
+            pos += 4;
+
+            int dx = 0, dy = 0;
+            if (flags & COMPONENT_ARGS_ARE_WORDS)
+            {
+                dx = ReadI16(pos);
+                dy = ReadI16(pos + 2);
+                pos += 4;
+            }
+            else
+            {
+                dx = (int8_t)ReadU8(pos);
+                dy = (int8_t)ReadU8(pos + 1);
+                pos += 2;
+            }
+
+            // Args that match points instead of giving an offset are treated as no offset
+            if (!(flags & COMPONENT_ARGS_ARE_XY))
+                dx = dy = 0;
+
+            float a = 1.0f, b = 0.0f, c = 0.0f, d = 1.0f;
+            if (flags & COMPONENT_SCALE)
+            {
+                a = d = ReadF2Dot14(ReadI16(pos));
+                pos += 2;
+            }
+            else if (flags & COMPONENT_XY_SCALE)
+            {
+                a = ReadF2Dot14(ReadI16(pos));
+                d = ReadF2Dot14(ReadI16(pos + 2));
+                pos += 4;
+            }
+            else if (flags & COMPONENT_TWO_BY_TWO)
+            {
+                a = ReadF2Dot14(ReadI16(pos));
+                b = ReadF2Dot14(ReadI16(pos + 2));
+                c = ReadF2Dot14(ReadI16(pos + 4));
+                d = ReadF2Dot14(ReadI16(pos + 6));
+                pos += 8;
+            }
+            if (pos > end) return false;
+
+            Transform child;
+            child.A = transform.A * a + transform.C * b;
+            child.B = transform.B * a + transform.D * b;
+            child.C = transform.A * c + transform.C * d;
+            child.D = transform.B * c + transform.D * d;
+            child.E = transform.A * dx + transform.C * dy + transform.E;
+            child.F = transform.B * dx + transform.D * dy + transform.F;
+
+            if (!AppendOutline(component, child, tolerance, depth + 1, componentBudget, contours))
+                return false;
+        } while (flags & COMPONENT_MORE);
+
+        return true;
+    }
+
+    // Simple: contour end indices, skipped hinting instructions, then packed points
+    std::vector<uint16_t> contourEnds(contourCount);
+    uint32_t pointCount = 0;
+    for (int i = 0; i < contourCount; i++)
+    {
+        contourEnds[i] = ReadU16(pos + (size_t)i * 2);
+        if (contourEnds[i] + 1u < pointCount) return false;
+        pointCount = contourEnds[i] + 1u;
+    }
+    pos += (size_t)contourCount * 2;
+
+    if (pos + 2 > end) return false;
+    pos += 2 + ReadU16(pos);
+
+    std::vector<uint8_t> flags(pointCount);
+    for (uint32_t i = 0; i < pointCount;)
+    {
+        if (pos >= end) return false;
+        uint8_t flag = ReadU8(pos++);
+        flags[i++] = flag;
+
+        if (flag & FLAG_REPEAT)
+        {
+            if (pos >= end) return false;
+            for (uint8_t repeat = ReadU8(pos++); repeat > 0 && i < pointCount; repeat--)
+                flags[i++] = flag;
+        }
+    }
+
+    // Coordinates are deltas, each short (one byte plus sign flag), long, or unchanged
+    std::vector<Point> points(pointCount);
+    for (int axis = 0; axis < 2; axis++)
+    {
+        uint8_t shortFlag = axis == 0 ? FLAG_X_SHORT : FLAG_Y_SHORT;
+        uint8_t sameFlag = axis == 0 ? FLAG_X_SAME_OR_POSITIVE : FLAG_Y_SAME_OR_POSITIVE;
+
+        int value = 0;
+        for (uint32_t i = 0; i < pointCount; i++)
+        {
+            if (flags[i] & shortFlag)
+            {
+                if (pos >= end) return false;
+                int delta = ReadU8(pos++);
+                value += (flags[i] & sameFlag) ? delta : -delta;
+            }
+            else if (!(flags[i] & sameFlag))
+            {
+                if (pos + 2 > end) return false;
+                value += ReadI16(pos);
+                pos += 2;
+            }
+
+            (axis == 0 ? points[i].X : points[i].Y) = (float)value;
+        }
+    }
+
+    for (Point& p : points)
+    {
+        Point local = p;
+        p.X = transform.A * local.X + transform.C * local.Y + transform.E;
+        p.Y = transform.B * local.X + transform.D * local.Y + transform.F;
+    }
+
+    // Quadratic B-splines: two off-curve points in a row imply an on-curve point halfway
+    auto addCurve = [tolerance](std::vector<Point>& line, Point from, Point control, Point to)
+    {
+        float ex = from.X - 2.0f * control.X + to.X;
+        float ey = from.Y - 2.0f * control.Y + to.Y;
+        // A quadratic strays at most |from - 2 * control + to| / 4 from its chord, and
+        // splitting it into n lines divides that by n^2
+        int segments = (int)std::ceil(std::sqrt(std::sqrt(ex * ex + ey * ey) / (4.0f * tolerance)));
+        segments = std::clamp(segments, 1, MAX_CURVE_SEGMENTS);
+
+        for (int s = 1; s <= segments; s++)
+        {
+            float t = (float)s / segments;
+            float u = 1.0f - t;
+            line.push_back({ u * u * from.X + 2.0f * u * t * control.X + t * t * to.X,
+                             u * u * from.Y + 2.0f * u * t * control.Y + t * t * to.Y });
+        }
+    };
+
+    uint32_t first = 0;
+    for (int c = 0; c < contourCount; c++)
+    {
+        uint32_t last = contourEnds[c];
+        uint32_t count = last + 1 - first;
+        if (count < 2)
+        {
+            first = last + 1;
+            continue;
+        }
+
+        // Start on an on-curve point, or between the first two points if there is none
+        uint32_t startIndex = count;
+        for (uint32_t i = 0; i < count; i++)
+        {
+            if (flags[first + i] & FLAG_ON_CURVE)
+            {
+                startIndex = i;
+                break;
+            }
+        }
+
+        Point start;
+        if (startIndex < count)
+            start = points[first + startIndex];
+        else
+        {
+            const Point& a = points[first + count - 1];
+            const Point& b = points[first];
+            start = { (a.X + b.X) * 0.5f, (a.Y + b.Y) * 0.5f };
+            startIndex = count - 1;  // Walk begins at the first point
+        }
+
+        std::vector<Point> line;
+        line.push_back(start);
+
+        Point current = start;
+        Point control{};
+        bool hasControl = false;
+
+        // Every point after the start, then back to the start itself
+        for (uint32_t step = 1; step <= count; step++)
+        {
+            uint32_t index = first + (startIndex + step) % count;
+            bool closing = step == count;
+            Point p = closing ? start : points[index];
+            bool onCurve = closing || (flags[index] & FLAG_ON_CURVE);
+
+            if (onCurve)
+            {
+                if (hasControl)
+                    addCurve(line, current, control, p);
+                else
+                    line.push_back(p);
+
+                current = p;
+                hasControl = false;
+            }
+            else
+            {
+                if (hasControl)
+                {
+                    Point mid = { (control.X + p.X) * 0.5f, (control.Y + p.Y) * 0.5f };
+                    addCurve(line, current, control, mid);
+                    current = mid;
+                }
+
+                control = p;
+                hasControl = true;
+            }
+        }
+
+        contours.push_back(std::move(line));
+        first = last + 1;
+    }
+
+    return true;
+}
+
+// ============================================
+// Distance fields
+// ============================================
+
+bool TrueTypeFont::RenderGlyphSDF(uint32_t glyph, float scale, int padding, unsigned char onEdgeValue,
+                                  float pixelDistScale, std::vector<unsigned char>& outPixels, int& outWidth,
+                                  int& outHeight, int& outXOffset, int& outYOffset) const
+{
+    outPixels.clear();
+    outWidth = outHeight = outXOffset = outYOffset = 0;
+    if (scale <= 0.0f) return false;
+
+    size_t offset, length;
+    if (!GetGlyphRange(glyph, offset, length) || length < 10) return false;
+
+    // Bounding box from the glyph header, in texels with Y down
+    int x0 = (int)std::floor(ReadI16(offset + 2) * scale);
+    int y0 = (int)std::floor(-ReadI16(offset + 8) * scale);
+    int x1 = (int)std::ceil(ReadI16(offset + 6) * scale);
+    int y1 = (int)std::ceil(-ReadI16(offset + 4) * scale);
+    if (x0 >= x1 || y0 >= y1 || x1 - x0 > MAX_GLYPH_TEXELS || y1 - y0 > MAX_GLYPH_TEXELS)
+        return false;
+
+    // Flatten to within a tenth of a texel
+    std::vector<std::vector<Point>> contours;
+    int componentBudget = MAX_COMPONENTS;
+    if (!AppendOutline(glyph, Transform(), 0.1f / scale, 0, componentBudget, contours) || contours.empty())
+        return false;
+
+    // Edges in texel space
+    struct Edge
+    {
+        float X0, Y0, X1, Y1;
+    };
+
+    std::vector<Edge> edges;
+    for (const std::vector<Point>& line : contours)
+    {
+        for (size_t i = 0; i + 1 < line.size(); i++)
+        {
+            edges.push_back({ line[i].X * scale, -line[i].Y * scale,
+                              line[i + 1].X * scale, -line[i + 1].Y * scale });
+        }
+    }
+
+    outXOffset = x0 - padding;
+    outYOffset = y0 - padding;
+    outWidth = x1 - x0 + padding * 2;
+    outHeight = y1 - y0 + padding * 2;
+    outPixels.resize((size_t)outWidth * outHeight);
+
+    for (int row = 0; row < outHeight; row++)
+    {
+        float py = outYOffset + row + 0.5f;
+
+        for (int col = 0; col < outWidth; col++)
+        {
+            float px = outXOffset + col + 0.5f;
+
+            // Distance to the nearest edge, and the nonzero winding rule for the sign
+            float minDistance2 = FLT_MAX;
+            int winding = 0;
+
+            for (const Edge& e : edges)
+            {
+                float ex = e.X1 - e.X0, ey = e.Y1 - e.Y0;
+                float rx = px - e.X0, ry = py - e.Y0;
+                float cross = ex * ry - ey * rx;
+
+                if (e.Y0 <= py)
+                {
+                    if (e.Y1 > py && cross > 0.0f) winding++;
+                }
+                else if (e.Y1 <= py && cross < 0.0f)
+                {
+                    winding--;
+                }
+
+                float lengthSq = ex * ex + ey * ey;
+                float t = lengthSq > 0.0f ? std::clamp((rx * ex + ry * ey) / lengthSq, 0.0f, 1.0f) : 0.0f;
+                float dx = rx - ex * t, dy = ry - ey * t;
+                minDistance2 = std::min(minDistance2, dx * dx + dy * dy);
+            }
+
+            float distance = std::sqrt(minDistance2);
+            if (winding == 0) distance = -distance;
+
+            float value = onEdgeValue + pixelDistScale * distance;
+            outPixels[(size_t)row * outWidth + col] = (unsigned char)std::clamp(value, 0.0f, 255.0f);
+        }
+    }
+
+    return true;
+}
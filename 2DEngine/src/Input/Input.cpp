@@ -79,17 +79,21 @@ glm::vec2 Input::GetMouseWorldPosition(const Camera& camera)
     // Get window size
     int width, height;
     glfwGetWindowSize(s_Window, &width, &height);
+    if (width <= 0 || height <= 0) return camera.GetPosition();
 
-    // Convert screen coordinates to NDC (-1 to 1)
-    glm::vec2 ndc;
-    ndc.x = (2.0f * s_MousePosition.x) / width - 1.0f;
-    ndc.y = 1.0f - (2.0f * s_MousePosition.y) / height; // Flip Y
+    // Window coordinates (Y down) -> normalized window position (Y up)
+    glm::vec2 window;
+    window.x = s_MousePosition.x / width;
+    window.y = 1.0f - s_MousePosition.y / height; // Flip Y
 
-    // Convert NDC to world space using inverse view-projection matrix
-    glm::mat4 invVP = glm::inverse(camera.GetViewProjectionMatrix());
-    glm::vec4 worldPos = invVP * glm::vec4(ndc, 0.0f, 1.0f);
+    // -> NDC (-1 to 1) within the camera's viewport
+    const glm::vec4& rect = camera.GetViewportRect();
+    glm::vec2 ndc;
+    ndc.x = 2.0f * (window.x - rect.x) / rect.z - 1.0f;
+    ndc.y = 2.0f * (window.y - rect.y) / rect.w - 1.0f;
 
-    return glm::vec2(worldPos.x, worldPos.y);
+    // Convert NDC to world space using the camera's cached inverse view-projection
+    return camera.NdcToWorld(ndc);
 }
 
 void Input::KeyCallback(GLFWwindow* window, int key, int scancode, int action, int mods)
@@ -0,0 +1,61 @@
+#include "Physics/AABBTreeBroadphase.h"
+#include "Physics/Collider.h"
+
+AABBTreeBroadphase::AABBTreeBroadphase(float margin)
+    : m_Tree(margin)
+    , m_BuildStamp(0)
+{
+}
+
+void AABBTreeBroadphase::Build(const std::vector<Collider*>& colliders)
+{
+    m_BuildStamp++;
+
+    for (uint32_t i = 0; i < (uint32_t)colliders.size(); i++)
+    {
+        const Collider* collider = colliders[i];
+        AABB bounds = collider->GetWorldBounds();
+        glm::vec2 center = bounds.GetCenter();
+
+        Proxy& proxy = m_Proxies[collider];
+        if (proxy.TreeProxy == DynamicAABBTree::NULL_NODE)
+            proxy.TreeProxy = m_Tree.CreateProxy(bounds, i);
+        else
+            m_Tree.MoveProxy(proxy.TreeProxy, bounds, center - proxy.Center);
+
+        m_Tree.SetUserData(proxy.TreeProxy, i);
+        proxy.Stamp = m_BuildStamp;
+        proxy.Center = center;
+    }
+
+    // Drop proxies whose collider was unregistered
+    for (auto it = m_Proxies.begin(); it != m_Proxies.end();)
+    {
+        if (it->second.Stamp != m_BuildStamp)
+        {
+            m_Tree.DestroyProxy(it->second.TreeProxy);
+            it = m_Proxies.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+}
+
+void AABBTreeBroadphase::Query(const AABB& bounds, std::vector<uint32_t>& outIndices) const
+{
+    m_Tree.Query(bounds, [&](int proxyId)
+    {
+        outIndices.push_back(m_Tree.GetUserData(proxyId));
+        return true;
+    });
+}
+
+void AABBTreeBroadphase::Raycast(const glm::vec2& start, const glm::vec2& end, RaycastVisitor& visitor) const
+{
+    m_Tree.Raycast(start, end, 1.0f, [&](int proxyId, float maxFraction)
+    {
+        return visitor.Visit(m_Tree.GetUserData(proxyId), maxFraction);
+    });
+}
@@ -0,0 +1,131 @@
+#include "Physics/AlphaMask.h"
+
+#include <stb_image.h>
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <tuple>
+
+struct MaskKey
+{
+    std::string Path;
+    int FrameCount;
+    int Frame;
+    uint8_t AlphaThreshold;
+
+    bool operator<(const MaskKey& other) const
+    {
+        return std::tie(Path, FrameCount, Frame, AlphaThreshold) <
+               std::tie(other.Path, other.FrameCount, other.Frame, other.AlphaThreshold);
+    }
+};
+
+static std::map<MaskKey, std::shared_ptr<const AlphaMask>> s_Cache;
+
+AlphaMask::AlphaMask(int width, int height)
+    : m_Width(std::max(width, 0))
+    , m_Height(std::max(height, 0))
+    , m_WordsPerRow((m_Width + 63) / 64)
+    , m_Bits((size_t)m_WordsPerRow * m_Height, 0)
+{
+}
+
+std::shared_ptr<const AlphaMask> AlphaMask::Load(const std::string& path, int frameCount, int frame,
+                                                 uint8_t alphaThreshold)
+{
+    MaskKey key{ path, frameCount, frame, alphaThreshold };
+    auto it = s_Cache.find(key);
+    if (it != s_Cache.end()) return it->second;
+
+    // Same orientation as Texture, so row 0 is the bottom of the sprite
+    int width = 0, height = 0, channels = 0;
+    stbi_set_flip_vertically_on_load(1);
+    unsigned char* data = stbi_load(path.c_str(), &width, &height, &channels, 4);
+
+    if (!data)
+    {
+        std::cerr << "Failed to load collision mask: " << path << "\n";
+        return nullptr;
+    }
+
+    int frameWidth = frameCount > 0 ? width / frameCount : width;
+    int firstColumn = frameWidth * std::clamp(frame, 0, std::max(frameCount - 1, 0));
+
+    auto mask = std::make_shared<AlphaMask>(frameWidth, height);
+    for (int y = 0; y < height; y++)
+    {
+        const unsigned char* row = data + ((size_t)y * width + firstColumn) * 4;
+        for (int x = 0; x < frameWidth; x++)
+        {
+            if (row[x * 4 + 3] >= alphaThreshold)
+                mask->Set(x, y, true);
+        }
+    }
+
+    stbi_image_free(data);
+
+    s_Cache[key] = mask;
+    return mask;
+}
+
+void AlphaMask::ClearCache()
+{
+    s_Cache.clear();
+}
+
+void AlphaMask::Set(int x, int y, bool value)
+{
+    if (x < 0 || y < 0 || x >= m_Width || y >= m_Height) return;
+
+    uint64_t& word = m_Bits[(size_t)y * m_WordsPerRow + (x >> 6)];
+    uint64_t bit = 1ull << (x & 63);
+    word = value ? (word | bit) : (word & ~bit);
+}
+
+bool AlphaMask::IsSet(int x, int y) const
+{
+    if (x < 0 || y < 0 || x >= m_Width || y >= m_Height) return false;
+    return (GetRow(y)[x >> 6] >> (x & 63)) & 1;
+}
+
+uint64_t AlphaMask::GetBits(int x, int y) const
+{
+    if (y < 0 || y >= m_Height || x >= m_Width || x <= -64) return 0;
+
+    const uint64_t* row = GetRow(y);
+
+    // Starts left of the mask: column 0 lands on bit -x
+    if (x < 0) return row[0] << -x;
+
+    int word = x >> 6;
+    int shift = x & 63;
+    uint64_t bits = row[word] >> shift;
+    if (shift != 0 && word + 1 < m_WordsPerRow)
+        bits |= row[word + 1] << (64 - shift);
+    return bits;
+}
+
+bool AlphaMask::AnyInRow(int y, int first, int last) const
+{
+    if (y < 0 || y >= m_Height) return false;
+
+    first = std::max(first, 0);
+    last = std::min(last, m_Width - 1);
+    if (first > last) return false;
+
+    const uint64_t* row = GetRow(y);
+    int firstWord = first >> 6;
+    int lastWord = last >> 6;
+    uint64_t firstMask = ~0ull << (first & 63);
+    uint64_t lastMask = ~0ull >> (63 - (last & 63));
+
+    if (firstWord == lastWord)
+        return (row[firstWord] & firstMask & lastMask) != 0;
+
+    if (row[firstWord] & firstMask) return true;
+    for (int word = firstWord + 1; word < lastWord; word++)
+    {
+        if (row[word]) return true;
+    }
+    return (row[lastWord] & lastMask) != 0;
+}
@@ -0,0 +1,232 @@
+#include "Physics/BoundsSoA.h"
+
+// Widest instruction set the compiler was allowed to use
+#if defined(__AVX2__)
+    #define BOUNDS_SIMD_AVX 1
+    #define BOUNDS_SIMD_GATHER 1
+    #include <immintrin.h>
+#elif defined(__AVX__)
+    #define BOUNDS_SIMD_AVX 1
+    #include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define BOUNDS_SIMD_SSE 1
+    #include <emmintrin.h>
+#endif
+
+void BoundsSoA::Resize(size_t count)
+{
+    MinX.resize(count);
+    MinY.resize(count);
+    MaxX.resize(count);
+    MaxY.resize(count);
+    Flags.resize(count);
+    Category.resize(count);
+    Mask.resize(count);
+}
+
+void BoundsSoA::Set(uint32_t index, const AABB& bounds, uint32_t flags, uint32_t category, uint32_t mask)
+{
+    MinX[index] = bounds.Min.x;
+    MinY[index] = bounds.Min.y;
+    MaxX[index] = bounds.Max.x;
+    MaxY[index] = bounds.Max.y;
+    Flags[index] = flags;
+    Category[index] = category;
+    Mask[index] = mask;
+}
+
+AABB BoundsSoA::Get(uint32_t index) const
+{
+    return AABB(glm::vec2(MinX[index], MinY[index]), glm::vec2(MaxX[index], MaxY[index]));
+}
+
+static bool OverlapsScalar(const BoundsSoA& b, uint32_t i, const AABB& q)
+{
+    return b.MinX[i] <= q.Max.x && b.MaxX[i] >= q.Min.x &&
+           b.MinY[i] <= q.Max.y && b.MaxY[i] >= q.Min.y;
+}
+
+static bool LayersMatch(const BoundsSoA& b, uint32_t i, uint32_t category, uint32_t mask)
+{
+    return ShouldCollide(b.Category[i], b.Mask[i], category, mask);
+}
+
+void OverlapRange(const BoundsSoA& bounds, const AABB& query, uint32_t begin, uint32_t end,
+                  std::vector<uint32_t>& outIndices)
+{
+    uint32_t i = begin;
+
+#if defined(BOUNDS_SIMD_AVX)
+    const __m256 qMinX = _mm256_set1_ps(query.Min.x);
+    const __m256 qMinY = _mm256_set1_ps(query.Min.y);
+    const __m256 qMaxX = _mm256_set1_ps(query.Max.x);
+    const __m256 qMaxY = _mm256_set1_ps(query.Max.y);
+
+    for (; i + 8 <= end; i += 8)
+    {
+        __m256 x = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(&bounds.MinX[i]), qMaxX, _CMP_LE_OQ),
+                                 _mm256_cmp_ps(_mm256_loadu_ps(&bounds.MaxX[i]), qMinX, _CMP_GE_OQ));
+        __m256 y = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(&bounds.MinY[i]), qMaxY, _CMP_LE_OQ),
+                                 _mm256_cmp_ps(_mm256_loadu_ps(&bounds.MaxY[i]), qMinY, _CMP_GE_OQ));
+
+        int mask = _mm256_movemask_ps(_mm256_and_ps(x, y));
+        for (int lane = 0; mask != 0; lane++, mask >>= 1)
+        {
+            if (mask & 1) outIndices.push_back(i + lane);
+        }
+    }
+#elif defined(BOUNDS_SIMD_SSE)
+    const __m128 qMinX = _mm_set1_ps(query.Min.x);
+    const __m128 qMinY = _mm_set1_ps(query.Min.y);
+    const __m128 qMaxX = _mm_set1_ps(query.Max.x);
+    const __m128 qMaxY = _mm_set1_ps(query.Max.y);
+
+    for (; i + 4 <= end; i += 4)
+    {
+        __m128 x = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(&bounds.MinX[i]), qMaxX),
+                              _mm_cmpge_ps(_mm_loadu_ps(&bounds.MaxX[i]), qMinX));
+        __m128 y = _mm_and_ps(_mm_cmple_ps(_mm_loadu_ps(&bounds.MinY[i]), qMaxY),
+                              _mm_cmpge_ps(_mm_loadu_ps(&bounds.MaxY[i]), qMinY));
+
+        int mask = _mm_movemask_ps(_mm_and_ps(x, y));
+        for (int lane = 0; mask != 0; lane++, mask >>= 1)
+        {
+            if (mask & 1) outIndices.push_back(i + lane);
+        }
+    }
+#endif
+
+    // Remainder (or everything, without SIMD)
+    for (; i < end; i++)
+    {
+        if (OverlapsScalar(bounds, i, query))
+            outIndices.push_back(i);
+    }
+}
+
+size_t FilterOverlaps(const BoundsSoA& bounds, const AABB& query, uint32_t category, uint32_t mask,
+                      uint32_t* indices, size_t count)
+{
+    size_t kept = 0;
+    size_t i = 0;
+
+    // Writes never overtake reads, so compacting in place is safe
+#if defined(BOUNDS_SIMD_AVX)
+    const __m256 qMinX = _mm256_set1_ps(query.Min.x);
+    const __m256 qMinY = _mm256_set1_ps(query.Min.y);
+    const __m256 qMaxX = _mm256_set1_ps(query.Max.x);
+    const __m256 qMaxY = _mm256_set1_ps(query.Max.y);
+    #if defined(BOUNDS_SIMD_GATHER)
+    const __m256i qCategory = _mm256_set1_epi32((int)category);
+    const __m256i qMask = _mm256_set1_epi32((int)mask);
+    const __m256i zero = _mm256_setzero_si256();
+    #endif
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const uint32_t* idx = indices + i;
+
+    #if defined(BOUNDS_SIMD_GATHER)
+        __m256i offsets = _mm256_loadu_si256((const __m256i*)idx);
+        __m256 minX = _mm256_i32gather_ps(bounds.MinX.data(), offsets, 4);
+        __m256 minY = _mm256_i32gather_ps(bounds.MinY.data(), offsets, 4);
+        __m256 maxX = _mm256_i32gather_ps(bounds.MaxX.data(), offsets, 4);
+        __m256 maxY = _mm256_i32gather_ps(bounds.MaxY.data(), offsets, 4);
+
+        // Rejected if (category & query mask) == 0 or (mask & query category) == 0
+        __m256i cat = _mm256_i32gather_epi32((const int*)bounds.Category.data(), offsets, 4);
+        __m256i msk = _mm256_i32gather_epi32((const int*)bounds.Mask.data(), offsets, 4);
+        __m256i rejected = _mm256_or_si256(_mm256_cmpeq_epi32(_mm256_and_si256(cat, qMask), zero),
+                                           _mm256_cmpeq_epi32(_mm256_and_si256(msk, qCategory), zero));
+    #else
+        #define GATHER8(arr) _mm256_setr_ps(arr[idx[0]], arr[idx[1]], arr[idx[2]], arr[idx[3]], \
+                                            arr[idx[4]], arr[idx[5]], arr[idx[6]], arr[idx[7]])
+        __m256 minX = GATHER8(bounds.MinX);
+        __m256 minY = GATHER8(bounds.MinY);
+        __m256 maxX = GATHER8(bounds.MaxX);
+        __m256 maxY = GATHER8(bounds.MaxY);
+        #undef GATHER8
+    #endif
+
+        __m256 x = _mm256_and_ps(_mm256_cmp_ps(minX, qMaxX, _CMP_LE_OQ), _mm256_cmp_ps(maxX, qMinX, _CMP_GE_OQ));
+        __m256 y = _mm256_and_ps(_mm256_cmp_ps(minY, qMaxY, _CMP_LE_OQ), _mm256_cmp_ps(maxY, qMinY, _CMP_GE_OQ));
+
+    #if defined(BOUNDS_SIMD_GATHER)
+        int hits = _mm256_movemask_ps(_mm256_andnot_ps(_mm256_castsi256_ps(rejected), _mm256_and_ps(x, y)));
+    #else
+        // No 256-bit integer ops without AVX2: layers are checked per overlapping lane
+        int hits = _mm256_movemask_ps(_mm256_and_ps(x, y));
+        for (int lane = 0; lane < 8; lane++)
+        {
+            if ((hits & (1 << lane)) && !LayersMatch(bounds, idx[lane], category, mask))
+                hits &= ~(1 << lane);
+        }
+    #endif
+
+        uint32_t lanes[8];
+        for (int lane = 0; lane < 8; lane++) lanes[lane] = idx[lane];
+        for (int lane = 0; lane < 8; lane++)
+        {
+            if (hits & (1 << lane)) indices[kept++] = lanes[lane];
+        }
+    }
+#elif defined(BOUNDS_SIMD_SSE)
+    const __m128 qMinX = _mm_set1_ps(query.Min.x);
+    const __m128 qMinY = _mm_set1_ps(query.Min.y);
+    const __m128 qMaxX = _mm_set1_ps(query.Max.x);
+    const __m128 qMaxY = _mm_set1_ps(query.Max.y);
+    const __m128i qCategory = _mm_set1_epi32((int)category);
+    const __m128i qMask = _mm_set1_epi32((int)mask);
+    const __m128i zero = _mm_setzero_si128();
+
+    for (; i + 4 <= count; i += 4)
+    {
+        const uint32_t* idx = indices + i;
+
+        #define GATHER4(arr) _mm_setr_ps(arr[idx[0]], arr[idx[1]], arr[idx[2]], arr[idx[3]])
+        __m128 minX = GATHER4(bounds.MinX);
+        __m128 minY = GATHER4(bounds.MinY);
+        __m128 maxX = GATHER4(bounds.MaxX);
+        __m128 maxY = GATHER4(bounds.MaxY);
+        #undef GATHER4
+
+        #define GATHER4I(arr) _mm_setr_epi32((int)arr[idx[0]], (int)arr[idx[1]], (int)arr[idx[2]], (int)arr[idx[3]])
+        __m128i cat = GATHER4I(bounds.Category);
+        __m128i msk = GATHER4I(bounds.Mask);
+        #undef GATHER4I
+
+        __m128 x = _mm_and_ps(_mm_cmple_ps(minX, qMaxX), _mm_cmpge_ps(maxX, qMinX));
+        __m128 y = _mm_and_ps(_mm_cmple_ps(minY, qMaxY), _mm_cmpge_ps(maxY, qMinY));
+        __m128i rejected = _mm_or_si128(_mm_cmpeq_epi32(_mm_and_si128(cat, qMask), zero),
+                                        _mm_cmpeq_epi32(_mm_and_si128(msk, qCategory), zero));
+
+        int hits = _mm_movemask_ps(_mm_andnot_ps(_mm_castsi128_ps(rejected), _mm_and_ps(x, y)));
+        uint32_t lanes[4] = { idx[0], idx[1], idx[2], idx[3] };
+        for (int lane = 0; lane < 4; lane++)
+        {
+            if (hits & (1 << lane)) indices[kept++] = lanes[lane];
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        if (OverlapsScalar(bounds, indices[i], query) && LayersMatch(bounds, indices[i], category, mask))
+            indices[kept++] = indices[i];
+    }
+
+    return kept;
+}
+
+const char* GetOverlapKernelName()
+{
+#if defined(BOUNDS_SIMD_GATHER)
+    return "AVX2";
+#elif defined(BOUNDS_SIMD_AVX)
+    return "AVX";
+#elif defined(BOUNDS_SIMD_SSE)
+    return "SSE2";
+#else
+    return "Scalar";
+#endif
+}
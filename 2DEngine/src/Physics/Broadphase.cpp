@@ -0,0 +1,31 @@
+#include "Physics/Broadphase.h"
+#include "Physics/Collider.h"
+
+void Broadphase::Raycast(const glm::vec2& start, const glm::vec2& end, RaycastVisitor& visitor) const
+{
+    // Generic path: everything in the segment's box, in no particular order. The
+    // scratch list is per thread, so concurrent rays neither share nor allocate it.
+    static thread_local std::vector<uint32_t> candidates;
+    candidates.clear();
+    Query(AABB(glm::min(start, end), glm::max(start, end)), candidates);
+
+    float maxFraction = 1.0f;
+    for (uint32_t index : candidates)
+    {
+        float value = visitor.Visit(index, maxFraction);
+        if (value == 0.0f) return;
+        if (value > 0.0f && value < maxFraction) maxFraction = value;
+    }
+}
+
+void BruteForceBroadphase::Build(const std::vector<Collider*>& colliders)
+{
+    m_Bounds.Resize(colliders.size());
+    for (uint32_t i = 0; i < (uint32_t)colliders.size(); i++)
+        m_Bounds.Set(i, colliders[i]->GetWorldBounds(), 0);
+}
+
+void BruteForceBroadphase::Query(const AABB& bounds, std::vector<uint32_t>& outIndices) const
+{
+    OverlapRange(m_Bounds, bounds, 0, (uint32_t)m_Bounds.Size(), outIndices);
+}
@@ -1,6 +1,9 @@
 #include "Physics/Collider.h"
+#include "Physics/Physics.h"
 #include "Entities/Entity.h"
-#include "Graphics/Renderer.h"
+#include "Graphics/DebugDraw.h"
+#include <algorithm>
+#include <cfloat>
 #include <cmath>
 
 // ============================================
@@ -13,9 +16,26 @@ Collider::Collider(Entity* owner, ColliderType type)
     , m_Offset(0.0f, 0.0f)
     , m_Enabled(true)
     , m_IsTrigger(false)
+    , m_IsBullet(false)
+    , m_IsStatic(false)
+    , m_Category(COLLISION_DEFAULT_CATEGORY)
+    , m_Mask(COLLISION_ALL_LAYERS)
+    , m_PhysicsIndex(0)
+    , m_PartitionIndex(0)
+    , m_SweepStart(0.0f, 0.0f)
 {
 }
 
+void Collider::SetStatic(bool isStatic)
+{
+    if (m_IsStatic == isStatic) return;
+
+    // Registered colliders move over to the other partition's broadphase
+    if (IsRegistered()) Physics::RemoveFromPartition(this);
+    m_IsStatic = isStatic;
+    if (IsRegistered()) Physics::AddToPartition(this);
+}
+
 glm::vec2 Collider::GetWorldPosition() const
 {
     if (!m_Owner) return m_Offset;
@@ -26,12 +46,29 @@ glm::vec2 Collider::GetWorldPosition() const
 bool CheckBoxBox(const BoxCollider* a, const BoxCollider* b);
 bool CheckCircleCircle(const CircleCollider* a, const CircleCollider* b);
 bool CheckBoxCircle(const BoxCollider* box, const CircleCollider* circle);
+static bool PenetrateBoxBox(const glm::vec2& aPos, const glm::vec2& aHalf, const glm::vec2& bPos, const glm::vec2& bHalf, Penetration& out);
+static bool PenetrateCircleCircle(const glm::vec2& aPos, float aRadius, const glm::vec2& bPos, float bRadius, Penetration& out);
+static bool PenetrateBoxCircle(const glm::vec2& boxPos, const glm::vec2& half, const glm::vec2& circlePos, float radius, Penetration& out);
+bool RaycastBox(const BoxCollider* box, const glm::vec2& start, const glm::vec2& end, float maxFraction, RaycastHit& outHit);
+bool RaycastCircle(const CircleCollider* circle, const glm::vec2& start, const glm::vec2& end, float maxFraction, RaycastHit& outHit);
+static bool RaycastAABB(const glm::vec2& boxMin, const glm::vec2& boxMax, const glm::vec2& start, const glm::vec2& end, float maxFraction, RaycastHit& outHit);
+static bool RaycastDisc(const glm::vec2& center, float radius, const glm::vec2& start, const glm::vec2& end, float maxFraction, RaycastHit& outHit);
+static bool RaycastRoundedBox(const glm::vec2& center, const glm::vec2& halfSize, float radius, const glm::vec2& start, const glm::vec2& end, float maxFraction, RaycastHit& outHit);
+static bool OverlapMask(const Collider* a, const glm::vec2& aPos, const Collider* b, const glm::vec2& bPos);
+static bool MaskOverlapsBox(const MaskCollider* mask, const glm::vec2& maskMin, const AABB& box);
+static bool MaskOverlapsCircle(const MaskCollider* mask, const glm::vec2& maskMin, const glm::vec2& center, float radius);
+static bool RaycastMask(const MaskCollider* mask, const glm::vec2& start, const glm::vec2& end, float maxFraction, RaycastHit& outHit);
+static bool SweepSampled(const Collider* moving, const Collider* other, const glm::vec2& from, const glm::vec2& to, float maxFraction, RaycastHit& outHit);
 
 bool Collider::CheckCollision(const Collider* other) const
 {
     if (!m_Enabled || !other->IsEnabled()) return false;
     if (!m_Owner || !other->GetOwner()) return false;
 
+    // Anything vs Mask
+    if (m_Type == ColliderType::Mask || other->GetType() == ColliderType::Mask)
+        return OverlapMask(this, GetWorldPosition(), other, other->GetWorldPosition());
+
     // Box vs Box
     if (m_Type == ColliderType::Box && other->GetType() == ColliderType::Box)
     {
@@ -63,6 +100,143 @@ bool Collider::CheckCollision(const Collider* other) const
     return false;
 }
 
+// Half size of a box, or of the box a mask is stretched over
+static glm::vec2 BoxHalfSize(const Collider* collider)
+{
+    if (collider->GetType() == ColliderType::Mask)
+        return static_cast<const MaskCollider*>(collider)->GetSize() * 0.5f;
+    return static_cast<const BoxCollider*>(collider)->GetSize() * 0.5f;
+}
+
+bool Collider::GetPenetration(const Collider* other, Penetration& outPenetration) const
+{
+    if (!m_Enabled || !other->IsEnabled()) return false;
+    if (!m_Owner || !other->GetOwner()) return false;
+
+    glm::vec2 pos = GetWorldPosition();
+    glm::vec2 otherPos = other->GetWorldPosition();
+
+    // Masks only touch where their texels do, but are pushed apart as their boxes
+    if (m_Type == ColliderType::Mask || other->GetType() == ColliderType::Mask)
+    {
+        if (!OverlapMask(this, pos, other, otherPos)) return false;
+    }
+
+    if (m_Type != ColliderType::Circle)
+    {
+        glm::vec2 half = BoxHalfSize(this);
+
+        if (other->GetType() != ColliderType::Circle)
+        {
+            glm::vec2 otherHalf = BoxHalfSize(other);
+            return PenetrateBoxBox(pos, half, otherPos, otherHalf, outPenetration);
+        }
+
+        float otherRadius = static_cast<const CircleCollider*>(other)->GetRadius();
+        return PenetrateBoxCircle(pos, half, otherPos, otherRadius, outPenetration);
+    }
+
+    float radius = static_cast<const CircleCollider*>(this)->GetRadius();
+
+    if (other->GetType() == ColliderType::Circle)
+    {
+        float otherRadius = static_cast<const CircleCollider*>(other)->GetRadius();
+        return PenetrateCircleCircle(pos, radius, otherPos, otherRadius, outPenetration);
+    }
+
+    // Circle vs box: measure from the box's side and flip
+    glm::vec2 otherHalf = BoxHalfSize(other);
+    if (!PenetrateBoxCircle(otherPos, otherHalf, pos, radius, outPenetration)) return false;
+    outPenetration.Normal = -outPenetration.Normal;
+    return true;
+}
+
+bool Collider::Raycast(const glm::vec2& start, const glm::vec2& end, float maxFraction, RaycastHit& outHit) const
+{
+    if (m_Type == ColliderType::Box)
+        return RaycastBox(static_cast<const BoxCollider*>(this), start, end, maxFraction, outHit);
+
+    if (m_Type == ColliderType::Circle)
+        return RaycastCircle(static_cast<const CircleCollider*>(this), start, end, maxFraction, outHit);
+
+    if (m_Type == ColliderType::Mask)
+        return RaycastMask(static_cast<const MaskCollider*>(this), start, end, maxFraction, outHit);
+
+    return false;
+}
+
+bool Collider::Sweep(const Collider* other, const glm::vec2& from, const glm::vec2& to, float maxFraction,
+                     RaycastHit& outHit) const
+{
+    if (m_Type == ColliderType::Mask || other->GetType() == ColliderType::Mask)
+        return SweepSampled(this, other, from, to, maxFraction, outHit);
+
+    // Shrink this collider to its center and grow 'other' by this shape (Minkowski sum),
+    // which turns the sweep into a raycast
+    glm::vec2 otherPos = other->GetWorldPosition();
+
+    if (m_Type == ColliderType::Box)
+    {
+        glm::vec2 half = static_cast<const BoxCollider*>(this)->GetSize() * 0.5f;
+
+        if (other->GetType() == ColliderType::Box)
+        {
+            glm::vec2 otherHalf = static_cast<const BoxCollider*>(other)->GetSize() * 0.5f;
+            return RaycastAABB(otherPos - otherHalf - half, otherPos + otherHalf + half, from, to, maxFraction, outHit);
+        }
+
+        float otherRadius = static_cast<const CircleCollider*>(other)->GetRadius();
+        return RaycastRoundedBox(otherPos, half, otherRadius, from, to, maxFraction, outHit);
+    }
+
+    float radius = static_cast<const CircleCollider*>(this)->GetRadius();
+
+    if (other->GetType() == ColliderType::Box)
+    {
+        glm::vec2 otherHalf = static_cast<const BoxCollider*>(other)->GetSize() * 0.5f;
+        return RaycastRoundedBox(otherPos, otherHalf, radius, from, to, maxFraction, outHit);
+    }
+
+    float otherRadius = static_cast<const CircleCollider*>(other)->GetRadius();
+    return RaycastDisc(otherPos, radius + otherRadius, from, to, maxFraction, outHit);
+}
+
+bool Collider::OverlapsBox(const AABB& box) const
+{
+    if (!m_Enabled || !m_Owner) return false;
+
+    if (m_Type == ColliderType::Box)
+        return GetWorldBounds().Overlaps(box);
+
+    if (m_Type == ColliderType::Circle)
+    {
+        glm::vec2 center = GetWorldPosition();
+        glm::vec2 closest = glm::clamp(center, box.Min, box.Max);
+        return glm::length(center - closest) <= static_cast<const CircleCollider*>(this)->GetRadius();
+    }
+
+    const MaskCollider* mask = static_cast<const MaskCollider*>(this);
+    return MaskOverlapsBox(mask, mask->GetMin(), box);
+}
+
+bool Collider::OverlapsCircle(const glm::vec2& center, float radius) const
+{
+    if (!m_Enabled || !m_Owner) return false;
+
+    if (m_Type == ColliderType::Box)
+    {
+        AABB bounds = GetWorldBounds();
+        glm::vec2 closest = glm::clamp(center, bounds.Min, bounds.Max);
+        return glm::length(center - closest) <= radius;
+    }
+
+    if (m_Type == ColliderType::Circle)
+        return glm::length(GetWorldPosition() - center) <= radius + static_cast<const CircleCollider*>(this)->GetRadius();
+
+    const MaskCollider* mask = static_cast<const MaskCollider*>(this);
+    return MaskOverlapsCircle(mask, mask->GetMin(), center, radius);
+}
+
 // ============================================
 // Box Collider
 // ============================================
@@ -93,7 +267,7 @@ void BoxCollider::DebugRender() const
         glm::vec4(0.0f, 1.0f, 0.0f, 0.3f) :  // Green for triggers
         glm::vec4(1.0f, 0.0f, 0.0f, 0.3f);   // Red for solid colliders
 
-    Renderer::DrawQuad(GetWorldPosition(), m_Size, color);
+    DebugDraw::FilledRect(GetWorldPosition(), m_Size, color);
 }
 
 // ============================================
@@ -106,6 +280,11 @@ CircleCollider::CircleCollider(Entity* owner, float radius)
 {
 }
 
+AABB CircleCollider::GetWorldBounds() const
+{
+    return AABB::FromCenter(GetWorldPosition(), glm::vec2(m_Radius * 2.0f));
+}
+
 void CircleCollider::DebugRender() const
 {
     if (!m_Enabled) return;
@@ -114,10 +293,79 @@ void CircleCollider::DebugRender() const
         glm::vec4(0.0f, 1.0f, 0.0f, 0.3f) :
         glm::vec4(1.0f, 0.0f, 0.0f, 0.3f);
 
-    // Approximate circle with a square for now
-    // TODO: Implement proper circle rendering
-    float diameter = m_Radius * 2.0f;
-    Renderer::DrawQuad(GetWorldPosition(), glm::vec2(diameter, diameter), color);
+    DebugDraw::FilledCircle(GetWorldPosition(), m_Radius, color);
+}
+
+// ============================================
+// Mask Collider
+// ============================================
+
+// Stands in for masks that failed to load: solid, so the collider acts like a box
+static std::shared_ptr<const AlphaMask> SolidMask()
+{
+    static std::shared_ptr<const AlphaMask> solid = []
+    {
+        auto mask = std::make_shared<AlphaMask>(1, 1);
+        mask->Set(0, 0, true);
+        return mask;
+    }();
+    return solid;
+}
+
+MaskCollider::MaskCollider(Entity* owner, const glm::vec2& size, std::shared_ptr<const AlphaMask> mask)
+    : Collider(owner, ColliderType::Mask)
+    , m_Size(size)
+    , m_Frame(0)
+{
+    m_Frames.push_back(mask ? std::move(mask) : SolidMask());
+}
+
+MaskCollider::MaskCollider(Entity* owner, const glm::vec2& size, const std::string& texturePath, int frameCount)
+    : Collider(owner, ColliderType::Mask)
+    , m_Size(size)
+    , m_Frame(0)
+{
+    frameCount = std::max(frameCount, 1);
+    for (int frame = 0; frame < frameCount; frame++)
+    {
+        std::shared_ptr<const AlphaMask> mask = AlphaMask::Load(texturePath, frameCount, frame);
+        m_Frames.push_back(mask ? std::move(mask) : SolidMask());
+    }
+}
+
+void MaskCollider::SetFrame(int frame)
+{
+    m_Frame = std::clamp(frame, 0, (int)m_Frames.size() - 1);
+}
+
+glm::vec2 MaskCollider::GetTexelSize() const
+{
+    const AlphaMask& mask = GetAlphaMask();
+    return glm::vec2(m_Size.x / std::max(mask.GetWidth(), 1), m_Size.y / std::max(mask.GetHeight(), 1));
+}
+
+glm::vec2 MaskCollider::GetMin() const
+{
+    glm::vec2 pos = GetWorldPosition();
+    return pos - m_Size * 0.5f;
+}
+
+glm::vec2 MaskCollider::GetMax() const
+{
+    glm::vec2 pos = GetWorldPosition();
+    return pos + m_Size * 0.5f;
+}
+
+void MaskCollider::DebugRender() const
+{
+    if (!m_Enabled) return;
+
+    glm::vec4 color = m_IsTrigger ? 
+        glm::vec4(0.0f, 1.0f, 0.0f, 0.3f) :
+        glm::vec4(1.0f, 0.0f, 0.0f, 0.3f);
+
+    // The box the mask covers, outlined so the sprite shows through
+    DebugDraw::Rect(GetWorldPosition(), m_Size, glm::vec4(glm::vec3(color), 0.8f));
 }
 
 // ============================================
@@ -162,4 +410,477 @@ bool CheckBoxCircle(const BoxCollider* box, const CircleCollider* circle)
     float distance = glm::length(circlePos - closest);
     
     return distance <= circle->GetRadius();
-}
\ No newline at end of file
+}
+
+// ============================================
+// Penetration Functions
+// ============================================
+
+// Axis of least overlap
+static bool PenetrateBoxBox(const glm::vec2& aPos, const glm::vec2& aHalf, const glm::vec2& bPos, const glm::vec2& bHalf, Penetration& out)
+{
+    glm::vec2 delta = bPos - aPos;
+    glm::vec2 overlap = aHalf + bHalf - glm::abs(delta);
+    if (overlap.x < 0.0f || overlap.y < 0.0f) return false;
+
+    if (overlap.x < overlap.y)
+    {
+        out.Normal = glm::vec2(delta.x < 0.0f ? -1.0f : 1.0f, 0.0f);
+        out.Depth = overlap.x;
+    }
+    else
+    {
+        out.Normal = glm::vec2(0.0f, delta.y < 0.0f ? -1.0f : 1.0f);
+        out.Depth = overlap.y;
+    }
+    return true;
+}
+
+static bool PenetrateCircleCircle(const glm::vec2& aPos, float aRadius, const glm::vec2& bPos, float bRadius, Penetration& out)
+{
+    glm::vec2 delta = bPos - aPos;
+    float radiusSum = aRadius + bRadius;
+    float distance2 = glm::dot(delta, delta);
+    if (distance2 > radiusSum * radiusSum) return false;
+
+    // Concentric circles have no preferred direction: push up
+    float distance = std::sqrt(distance2);
+    out.Normal = distance > 0.0f ? delta / distance : glm::vec2(0.0f, 1.0f);
+    out.Depth = radiusSum - distance;
+    return true;
+}
+
+// Normal points from the box to the circle
+static bool PenetrateBoxCircle(const glm::vec2& boxPos, const glm::vec2& half, const glm::vec2& circlePos, float radius, Penetration& out)
+{
+    glm::vec2 delta = circlePos - boxPos;
+    glm::vec2 closest = glm::clamp(delta, -half, half);
+
+    if (closest != delta)
+    {
+        // Center outside the box: push away from the closest point on it
+        glm::vec2 offset = delta - closest;
+        float distance2 = glm::dot(offset, offset);
+        if (distance2 > radius * radius) return false;
+
+        float distance = std::sqrt(distance2);
+        out.Normal = offset / distance;
+        out.Depth = radius - distance;
+        return true;
+    }
+
+    // Center inside the box: out through the nearest face
+    glm::vec2 faceDistance = half - glm::abs(delta);
+    if (faceDistance.x < faceDistance.y)
+    {
+        out.Normal = glm::vec2(delta.x < 0.0f ? -1.0f : 1.0f, 0.0f);
+        out.Depth = faceDistance.x + radius;
+    }
+    else
+    {
+        out.Normal = glm::vec2(0.0f, delta.y < 0.0f ? -1.0f : 1.0f);
+        out.Depth = faceDistance.y + radius;
+    }
+    return true;
+}
+
+// ============================================
+// Raycast Functions
+// ============================================
+
+// Hit reported when the segment starts inside a collider
+static void InsideHit(const glm::vec2& start, const glm::vec2& end, RaycastHit& outHit)
+{
+    glm::vec2 d = end - start;
+    float length = glm::length(d);
+
+    outHit.Point = start;
+    outHit.Normal = length > 0.0f ? -d / length : glm::vec2(0.0f);
+    outHit.Fraction = 0.0f;
+}
+
+bool RaycastBox(const BoxCollider* box, const glm::vec2& start, const glm::vec2& end, float maxFraction, RaycastHit& outHit)
+{
+    return RaycastAABB(box->GetMin(), box->GetMax(), start, end, maxFraction, outHit);
+}
+
+bool RaycastCircle(const CircleCollider* circle, const glm::vec2& start, const glm::vec2& end, float maxFraction, RaycastHit& outHit)
+{
+    return RaycastDisc(circle->GetWorldPosition(), circle->GetRadius(), start, end, maxFraction, outHit);
+}
+
+static bool RaycastAABB(const glm::vec2& boxMin, const glm::vec2& boxMax, const glm::vec2& start, const glm::vec2& end, float maxFraction, RaycastHit& outHit)
+{
+    glm::vec2 d = end - start;
+
+    // Slab test: clip the segment against the X and Y extents in turn
+    float tEnter = -FLT_MAX;
+    float tExit = maxFraction;
+    glm::vec2 normal(0.0f);
+
+    for (int axis = 0; axis < 2; axis++)
+    {
+        if (d[axis] == 0.0f)
+        {
+            // Parallel to this slab: must already be between its faces
+            if (start[axis] < boxMin[axis] || start[axis] > boxMax[axis])
+                return false;
+            continue;
+        }
+
+        float t1 = (boxMin[axis] - start[axis]) / d[axis];
+        float t2 = (boxMax[axis] - start[axis]) / d[axis];
+        float side = -1.0f;  // Entering through the min face
+        if (t1 > t2)
+        {
+            std::swap(t1, t2);
+            side = 1.0f;
+        }
+
+        if (t1 > tEnter)
+        {
+            tEnter = t1;
+            normal = glm::vec2(0.0f);
+            normal[axis] = side;
+        }
+
+        tExit = std::min(tExit, t2);
+        if (tEnter > tExit || tExit < 0.0f)
+            return false;
+    }
+
+    if (tEnter < 0.0f)
+    {
+        InsideHit(start, end, outHit);
+        return true;
+    }
+
+    outHit.Point = start + d * tEnter;
+    outHit.Normal = normal;
+    outHit.Fraction = tEnter;
+    return true;
+}
+
+static bool RaycastDisc(const glm::vec2& center, float radius, const glm::vec2& start, const glm::vec2& end, float maxFraction, RaycastHit& outHit)
+{
+    // Solve |start + t * d - center| = radius for the smaller t
+    glm::vec2 m = start - center;
+    glm::vec2 d = end - start;
+    float c = glm::dot(m, m) - radius * radius;
+
+    if (c <= 0.0f)
+    {
+        InsideHit(start, end, outHit);
+        return true;
+    }
+
+    float a = glm::dot(d, d);
+    float b = glm::dot(m, d);
+    float discriminant = b * b - a * c;
+    if (a == 0.0f || discriminant < 0.0f)
+        return false;
+
+    float t = (-b - std::sqrt(discriminant)) / a;
+    if (t < 0.0f || t > maxFraction)
+        return false;
+
+    outHit.Point = start + d * t;
+    outHit.Normal = (outHit.Point - center) / radius;
+    outHit.Fraction = t;
+    return true;
+}
+
+// Box of the given half size with its corners rounded by radius: the union of two
+// boxes (one grown along each axis) and a disc at each corner. The earliest entry
+// into any of them is the entry into the shape.
+static bool RaycastRoundedBox(const glm::vec2& center, const glm::vec2& halfSize, float radius, const glm::vec2& start, const glm::vec2& end, float maxFraction, RaycastHit& outHit)
+{
+    bool hit = false;
+    RaycastHit candidate;
+
+    auto keep = [&]()
+    {
+        outHit = candidate;
+        maxFraction = candidate.Fraction;
+        hit = true;
+    };
+
+    glm::vec2 wide(halfSize.x + radius, halfSize.y);
+    glm::vec2 tall(halfSize.x, halfSize.y + radius);
+    if (RaycastAABB(center - wide, center + wide, start, end, maxFraction, candidate)) keep();
+    if (RaycastAABB(center - tall, center + tall, start, end, maxFraction, candidate)) keep();
+
+    static const glm::vec2 corners[4] = { { -1.0f, -1.0f }, { 1.0f, -1.0f }, { -1.0f, 1.0f }, { 1.0f, 1.0f } };
+    for (const glm::vec2& corner : corners)
+    {
+        if (RaycastDisc(center + corner * halfSize, radius, start, end, maxFraction, candidate)) keep();
+    }
+
+    return hit;
+}
+
+// ============================================
+// Mask Functions
+// ============================================
+
+// Most samples a sweep against a mask takes (long sweeps past this step further apart)
+static const int MAX_SWEEP_SAMPLES = 256;
+static const int SWEEP_BISECTIONS = 10;
+
+// Texels (size 'texel', starting at 'origin') that the range [lo, hi] touches along one
+// axis, clamped to the mask. first > last when there are none.
+static void TexelSpan(float origin, float texel, int count, float lo, float hi, int& first, int& last)
+{
+    if (!(texel > 0.0f))
+    {
+        first = 0;
+        last = -1;
+        return;
+    }
+
+    first = (int)std::clamp(std::floor((lo - origin) / texel), 0.0f, (float)count);
+    last = (int)std::clamp(std::floor((hi - origin) / texel), -1.0f, (float)(count - 1));
+}
+
+static bool MaskOverlapsBox(const MaskCollider* mask, const glm::vec2& maskMin, const AABB& box)
+{
+    if (!AABB(maskMin, maskMin + mask->GetSize()).Overlaps(box)) return false;
+
+    const AlphaMask& bits = mask->GetAlphaMask();
+    glm::vec2 texel = mask->GetTexelSize();
+
+    int firstColumn, lastColumn, firstRow, lastRow;
+    TexelSpan(maskMin.x, texel.x, bits.GetWidth(), box.Min.x, box.Max.x, firstColumn, lastColumn);
+    TexelSpan(maskMin.y, texel.y, bits.GetHeight(), box.Min.y, box.Max.y, firstRow, lastRow);
+
+    for (int y = firstRow; y <= lastRow; y++)
+    {
+        if (bits.AnyInRow(y, firstColumn, lastColumn)) return true;
+    }
+    return false;
+}
+
+static bool MaskOverlapsCircle(const MaskCollider* mask, const glm::vec2& maskMin, const glm::vec2& center, float radius)
+{
+    if (!AABB(maskMin, maskMin + mask->GetSize()).Overlaps(AABB::FromCenter(center, glm::vec2(radius * 2.0f))))
+        return false;
+
+    const AlphaMask& bits = mask->GetAlphaMask();
+    glm::vec2 texel = mask->GetTexelSize();
+
+    int firstRow, lastRow;
+    TexelSpan(maskMin.y, texel.y, bits.GetHeight(), center.y - radius, center.y + radius, firstRow, lastRow);
+
+    // The circle covers a chord of each row, widest at the row's point nearest the center
+    for (int y = firstRow; y <= lastRow; y++)
+    {
+        float rowBottom = maskMin.y + y * texel.y;
+        float dy = std::clamp(center.y, rowBottom, rowBottom + texel.y) - center.y;
+        float halfChordSq = radius * radius - dy * dy;
+        if (halfChordSq < 0.0f) continue;
+
+        float halfChord = std::sqrt(halfChordSq);
+        int firstColumn, lastColumn;
+        TexelSpan(maskMin.x, texel.x, bits.GetWidth(), center.x - halfChord, center.x + halfChord, firstColumn, lastColumn);
+        if (bits.AnyInRow(y, firstColumn, lastColumn)) return true;
+    }
+    return false;
+}
+
+// Walks a's texels inside the overlap, sampling b at their centers
+static bool MaskOverlapsMask(const MaskCollider* a, const glm::vec2& aMin, const MaskCollider* b, const glm::vec2& bMin)
+{
+    AABB aBounds(aMin, aMin + a->GetSize());
+    AABB bBounds(bMin, bMin + b->GetSize());
+    if (!aBounds.Overlaps(bBounds)) return false;
+
+    const AlphaMask& aBits = a->GetAlphaMask();
+    const AlphaMask& bBits = b->GetAlphaMask();
+    glm::vec2 aTexel = a->GetTexelSize();
+    glm::vec2 bTexel = b->GetTexelSize();
+
+    int firstColumn, lastColumn, firstRow, lastRow;
+    TexelSpan(aMin.x, aTexel.x, aBits.GetWidth(), bBounds.Min.x, bBounds.Max.x, firstColumn, lastColumn);
+    TexelSpan(aMin.y, aTexel.y, aBits.GetHeight(), bBounds.Min.y, bBounds.Max.y, firstRow, lastRow);
+
+    // Same texel width: b's columns line up with a's after a whole-texel shift, so rows
+    // compare 64 texels per AND. Otherwise b is resampled onto a's columns first.
+    bool aligned = std::abs(aTexel.x - bTexel.x) <= aTexel.x * 1e-4f;
+    int columnShift = (int)std::floor((aMin.x - bMin.x) / bTexel.x + 0.5f);
+
+    for (int y = firstRow; y <= lastRow; y++)
+    {
+        int by = (int)std::floor((aMin.y + (y + 0.5f) * aTexel.y - bMin.y) / bTexel.y);
+        if (by < 0 || by >= bBits.GetHeight()) continue;
+
+        for (int x = firstColumn; x <= lastColumn; x += 64)
+        {
+            int count = std::min(lastColumn - x + 1, 64);
+            uint64_t span = count == 64 ? ~0ull : (1ull << count) - 1;
+            uint64_t aWord = aBits.GetBits(x, y) & span;
+            if (!aWord) continue;
+
+            uint64_t bWord = 0;
+            if (aligned)
+            {
+                bWord = bBits.GetBits(x + columnShift, by);
+            }
+            else
+            {
+                for (int k = 0; k < count; k++)
+                {
+                    if (!((aWord >> k) & 1)) continue;
+                    int bx = (int)std::floor((aMin.x + (x + k + 0.5f) * aTexel.x - bMin.x) / bTexel.x);
+                    if (bBits.IsSet(bx, by)) bWord |= 1ull << k;
+                }
+            }
+
+            if (aWord & bWord) return true;
+        }
+    }
+    return false;
+}
+
+// At least one of a and b is a mask; each is tested as if centered at the given position
+static bool OverlapMask(const Collider* a, const glm::vec2& aPos, const Collider* b, const glm::vec2& bPos)
+{
+    if (a->GetType() != ColliderType::Mask)
+        return OverlapMask(b, bPos, a, aPos);
+
+    const MaskCollider* mask = static_cast<const MaskCollider*>(a);
+    glm::vec2 maskMin = aPos - mask->GetSize() * 0.5f;
+
+    if (b->GetType() == ColliderType::Box)
+        return MaskOverlapsBox(mask, maskMin, AABB::FromCenter(bPos, static_cast<const BoxCollider*>(b)->GetSize()));
+
+    if (b->GetType() == ColliderType::Circle)
+        return MaskOverlapsCircle(mask, maskMin, bPos, static_cast<const CircleCollider*>(b)->GetRadius());
+
+    const MaskCollider* other = static_cast<const MaskCollider*>(b);
+    return MaskOverlapsMask(mask, maskMin, other, bPos - other->GetSize() * 0.5f);
+}
+
+// Enters the box, then steps texel by texel along the segment until one is set
+static bool RaycastMask(const MaskCollider* mask, const glm::vec2& start, const glm::vec2& end, float maxFraction, RaycastHit& outHit)
+{
+    glm::vec2 boxMin = mask->GetMin();
+    RaycastHit entry;
+    if (!RaycastAABB(boxMin, mask->GetMax(), start, end, maxFraction, entry)) return false;
+
+    const AlphaMask& bits = mask->GetAlphaMask();
+    glm::vec2 texel = mask->GetTexelSize();
+    glm::vec2 d = end - start;
+
+    float t = entry.Fraction;
+    glm::vec2 normal = entry.Normal;
+    glm::vec2 local = (start + d * t - boxMin) / texel;
+    int x = std::clamp((int)std::floor(local.x), 0, bits.GetWidth() - 1);
+    int y = std::clamp((int)std::floor(local.y), 0, bits.GetHeight() - 1);
+
+    // Fraction at which the segment crosses the next column/row boundary, and per texel
+    int stepX = d.x > 0.0f ? 1 : -1;
+    int stepY = d.y > 0.0f ? 1 : -1;
+    float nextX = d.x != 0.0f ? (boxMin.x + (x + (stepX > 0 ? 1 : 0)) * texel.x - start.x) / d.x : FLT_MAX;
+    float nextY = d.y != 0.0f ? (boxMin.y + (y + (stepY > 0 ? 1 : 0)) * texel.y - start.y) / d.y : FLT_MAX;
+    float deltaX = d.x != 0.0f ? texel.x / std::abs(d.x) : FLT_MAX;
+    float deltaY = d.y != 0.0f ? texel.y / std::abs(d.y) : FLT_MAX;
+
+    while (!bits.IsSet(x, y))
+    {
+        if (nextX < nextY)
+        {
+            t = nextX;
+            x += stepX;
+            nextX += deltaX;
+            normal = glm::vec2((float)-stepX, 0.0f);
+        }
+        else
+        {
+            t = nextY;
+            y += stepY;
+            nextY += deltaY;
+            normal = glm::vec2(0.0f, (float)-stepY);
+        }
+
+        if (t > maxFraction || x < 0 || y < 0 || x >= bits.GetWidth() || y >= bits.GetHeight())
+            return false;
+    }
+
+    outHit.Point = start + d * t;
+    outHit.Normal = normal;
+    outHit.Fraction = t;
+    return true;
+}
+
+// Smallest thing a sampled sweep must not step over
+static float SmallestFeature(const Collider* collider)
+{
+    if (collider->GetType() == ColliderType::Box)
+    {
+        glm::vec2 size = static_cast<const BoxCollider*>(collider)->GetSize();
+        return std::min(size.x, size.y);
+    }
+
+    if (collider->GetType() == ColliderType::Circle)
+        return static_cast<const CircleCollider*>(collider)->GetRadius() * 2.0f;
+
+    glm::vec2 texel = static_cast<const MaskCollider*>(collider)->GetTexelSize();
+    return std::min(texel.x, texel.y);
+}
+
+// Masks have no Minkowski sum to raycast, so step along the path (never further than
+// the two shapes' smallest features, so neither can hop over the other) and bisect the
+// first step that overlaps
+static bool SweepSampled(const Collider* moving, const Collider* other, const glm::vec2& from, const glm::vec2& to, float maxFraction, RaycastHit& outHit)
+{
+    glm::vec2 otherPos = other->GetWorldPosition();
+    glm::vec2 d = to - from;
+
+    // Box around the whole path first
+    AABB bounds = moving->GetWorldBounds();
+    glm::vec2 startOffset = from - moving->GetWorldPosition();
+    glm::vec2 endOffset = startOffset + d * maxFraction;
+    AABB path(bounds.Min + glm::min(startOffset, endOffset), bounds.Max + glm::max(startOffset, endOffset));
+    if (!path.Overlaps(other->GetWorldBounds())) return false;
+
+    if (OverlapMask(moving, from, other, otherPos))
+    {
+        InsideHit(from, to, outHit);
+        return true;
+    }
+
+    float distance = glm::length(d) * maxFraction;
+    if (distance <= 0.0f) return false;
+
+    float spacing = 0.5f * (SmallestFeature(moving) + SmallestFeature(other));
+    int samples = MAX_SWEEP_SAMPLES;
+    if (spacing > 0.0f)
+        samples = (int)std::clamp(std::ceil(distance / spacing), 1.0f, (float)MAX_SWEEP_SAMPLES);
+
+    float previous = 0.0f;
+    for (int i = 1; i <= samples; i++)
+    {
+        float t = maxFraction * i / samples;
+        if (!OverlapMask(moving, from + d * t, other, otherPos))
+        {
+            previous = t;
+            continue;
+        }
+
+        for (int j = 0; j < SWEEP_BISECTIONS; j++)
+        {
+            float middle = (previous + t) * 0.5f;
+            if (OverlapMask(moving, from + d * middle, other, otherPos))
+                t = middle;
+            else
+                previous = middle;
+        }
+
+        // Which texel face was hit isn't tracked: report the one facing the motion
+        outHit.Point = from + d * t;
+        outHit.Normal = -d / glm::length(d);
+        outHit.Fraction = t;
+        return true;
+    }
+    return false;
+}
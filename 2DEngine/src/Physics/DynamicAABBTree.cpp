@@ -0,0 +1,351 @@
+#include "Physics/DynamicAABBTree.h"
+
+#include <algorithm>
+
+static AABB Union(const AABB& a, const AABB& b)
+{
+    return AABB(glm::min(a.Min, b.Min), glm::max(a.Max, b.Max));
+}
+
+static float Perimeter(const AABB& box)
+{
+    glm::vec2 size = box.GetSize();
+    return 2.0f * (size.x + size.y);
+}
+
+static bool ContainsBox(const AABB& outer, const AABB& inner)
+{
+    return outer.Min.x <= inner.Min.x && outer.Min.y <= inner.Min.y &&
+           inner.Max.x <= outer.Max.x && inner.Max.y <= outer.Max.y;
+}
+
+DynamicAABBTree::DynamicAABBTree(float margin)
+    : m_Root(NULL_NODE)
+    , m_FreeList(NULL_NODE)
+    , m_ProxyCount(0)
+    , m_Margin(margin)
+{
+}
+
+int DynamicAABBTree::AllocateNode()
+{
+    if (m_FreeList == NULL_NODE)
+    {
+        m_Nodes.emplace_back();
+        return (int)m_Nodes.size() - 1;
+    }
+
+    int node = m_FreeList;
+    m_FreeList = m_Nodes[node].Parent;
+    m_Nodes[node] = Node();
+    return node;
+}
+
+void DynamicAABBTree::FreeNode(int node)
+{
+    m_Nodes[node].Parent = m_FreeList;
+    m_Nodes[node].Height = -1;
+    m_FreeList = node;
+}
+
+int DynamicAABBTree::CreateProxy(const AABB& bounds, uint32_t userData)
+{
+    int proxy = AllocateNode();
+
+    Node& node = m_Nodes[proxy];
+    node.Box = AABB(bounds.Min - glm::vec2(m_Margin), bounds.Max + glm::vec2(m_Margin));
+    node.UserData = userData;
+    node.Height = 0;
+
+    InsertLeaf(proxy);
+    m_ProxyCount++;
+    return proxy;
+}
+
+void DynamicAABBTree::DestroyProxy(int proxyId)
+{
+    RemoveLeaf(proxyId);
+    FreeNode(proxyId);
+    m_ProxyCount--;
+}
+
+bool DynamicAABBTree::MoveProxy(int proxyId, const AABB& bounds, const glm::vec2& displacement)
+{
+    // Still inside its fat box: nothing to do
+    if (ContainsBox(m_Nodes[proxyId].Box, bounds))
+        return false;
+
+    RemoveLeaf(proxyId);
+
+    // Grow by the margin, and further along the direction of travel
+    AABB fat(bounds.Min - glm::vec2(m_Margin), bounds.Max + glm::vec2(m_Margin));
+    glm::vec2 predicted = displacement * 2.0f;
+    fat.Min = glm::min(fat.Min, fat.Min + predicted);
+    fat.Max = glm::max(fat.Max, fat.Max + predicted);
+
+    m_Nodes[proxyId].Box = fat;
+    InsertLeaf(proxyId);
+    return true;
+}
+
+void DynamicAABBTree::Clear()
+{
+    m_Nodes.clear();
+    m_Root = NULL_NODE;
+    m_FreeList = NULL_NODE;
+    m_ProxyCount = 0;
+}
+
+// Branch and bound search for the sibling that grows the tree's total perimeter the
+// least. Putting the leaf next to a node costs the perimeter of their union, plus how
+// much every ancestor's box grows; a subtree is skipped once that growth alone is
+// already worse than the best candidate found.
+int DynamicAABBTree::FindBestSibling(const AABB& leafBox)
+{
+    float leafArea = Perimeter(leafBox);
+
+    int best = m_Root;
+    float bestCost = Perimeter(Union(m_Nodes[m_Root].Box, leafBox));
+
+    std::vector<SiblingCandidate>& stack = m_SiblingStack;
+    stack.clear();
+    stack.push_back({ m_Root, 0.0f });
+
+    while (!stack.empty())
+    {
+        SiblingCandidate candidate = stack.back();
+        stack.pop_back();
+
+        const Node& node = m_Nodes[candidate.Node];
+        float directCost = Perimeter(Union(node.Box, leafBox));
+        float cost = directCost + candidate.InheritedCost;
+
+        if (cost < bestCost)
+        {
+            best = candidate.Node;
+            bestCost = cost;
+        }
+
+        if (node.IsLeaf()) continue;
+
+        // Any sibling below this node grows it by at least this much
+        float childInherited = candidate.InheritedCost + directCost - Perimeter(node.Box);
+        if (leafArea + childInherited < bestCost)
+        {
+            stack.push_back({ node.Child1, childInherited });
+            stack.push_back({ node.Child2, childInherited });
+        }
+    }
+
+    return best;
+}
+
+void DynamicAABBTree::InsertLeaf(int leaf)
+{
+    if (m_Root == NULL_NODE)
+    {
+        m_Root = leaf;
+        m_Nodes[leaf].Parent = NULL_NODE;
+        return;
+    }
+
+    int sibling = FindBestSibling(m_Nodes[leaf].Box);
+
+    // Splice a new parent in above the sibling
+    AABB leafBox = m_Nodes[leaf].Box;
+    int oldParent = m_Nodes[sibling].Parent;
+    int newParent = AllocateNode();
+    m_Nodes[newParent].Parent = oldParent;
+    m_Nodes[newParent].Box = Union(leafBox, m_Nodes[sibling].Box);
+    m_Nodes[newParent].Height = m_Nodes[sibling].Height + 1;
+    m_Nodes[newParent].Child1 = sibling;
+    m_Nodes[newParent].Child2 = leaf;
+    m_Nodes[sibling].Parent = newParent;
+    m_Nodes[leaf].Parent = newParent;
+
+    if (oldParent != NULL_NODE)
+    {
+        if (m_Nodes[oldParent].Child1 == sibling)
+            m_Nodes[oldParent].Child1 = newParent;
+        else
+            m_Nodes[oldParent].Child2 = newParent;
+    }
+    else
+    {
+        m_Root = newParent;
+    }
+
+    // Walk back up, rebalancing and refitting
+    int index = m_Nodes[leaf].Parent;
+    while (index != NULL_NODE)
+    {
+        index = Balance(index);
+
+        Node& node = m_Nodes[index];
+        const Node& child1 = m_Nodes[node.Child1];
+        const Node& child2 = m_Nodes[node.Child2];
+        node.Height = 1 + std::max(child1.Height, child2.Height);
+        node.Box = Union(child1.Box, child2.Box);
+
+        index = node.Parent;
+    }
+}
+
+void DynamicAABBTree::RemoveLeaf(int leaf)
+{
+    if (leaf == m_Root)
+    {
+        m_Root = NULL_NODE;
+        return;
+    }
+
+    int parent = m_Nodes[leaf].Parent;
+    int grandParent = m_Nodes[parent].Parent;
+    int sibling = m_Nodes[parent].Child1 == leaf ? m_Nodes[parent].Child2 : m_Nodes[parent].Child1;
+
+    // The sibling takes the parent's place
+    if (grandParent != NULL_NODE)
+    {
+        if (m_Nodes[grandParent].Child1 == parent)
+            m_Nodes[grandParent].Child1 = sibling;
+        else
+            m_Nodes[grandParent].Child2 = sibling;
+        m_Nodes[sibling].Parent = grandParent;
+        FreeNode(parent);
+
+        int index = grandParent;
+        while (index != NULL_NODE)
+        {
+            index = Balance(index);
+
+            Node& node = m_Nodes[index];
+            const Node& child1 = m_Nodes[node.Child1];
+            const Node& child2 = m_Nodes[node.Child2];
+            node.Height = 1 + std::max(child1.Height, child2.Height);
+            node.Box = Union(child1.Box, child2.Box);
+
+            index = node.Parent;
+        }
+    }
+    else
+    {
+        m_Root = sibling;
+        m_Nodes[sibling].Parent = NULL_NODE;
+        FreeNode(parent);
+    }
+}
+
+// If one child of iA is more than one level taller than the other, rotate it up
+// to take iA's place. Returns the index of the subtree's new root.
+int DynamicAABBTree::Balance(int iA)
+{
+    Node& A = m_Nodes[iA];
+    if (A.IsLeaf() || A.Height < 2)
+        return iA;
+
+    int iB = A.Child1;
+    int iC = A.Child2;
+    Node& B = m_Nodes[iB];
+    Node& C = m_Nodes[iC];
+
+    int balance = C.Height - B.Height;
+
+    // Rotate C up
+    if (balance > 1)
+    {
+        int iF = C.Child1;
+        int iG = C.Child2;
+        Node& F = m_Nodes[iF];
+        Node& G = m_Nodes[iG];
+
+        C.Child1 = iA;
+        C.Parent = A.Parent;
+        A.Parent = iC;
+
+        if (C.Parent != NULL_NODE)
+        {
+            if (m_Nodes[C.Parent].Child1 == iA)
+                m_Nodes[C.Parent].Child1 = iC;
+            else
+                m_Nodes[C.Parent].Child2 = iC;
+        }
+        else
+        {
+            m_Root = iC;
+        }
+
+        // Keep the taller of F and G under C, hand the other to A
+        if (F.Height > G.Height)
+        {
+            C.Child2 = iF;
+            A.Child2 = iG;
+            G.Parent = iA;
+            A.Box = Union(B.Box, G.Box);
+            C.Box = Union(A.Box, F.Box);
+            A.Height = 1 + std::max(B.Height, G.Height);
+            C.Height = 1 + std::max(A.Height, F.Height);
+        }
+        else
+        {
+            C.Child2 = iG;
+            A.Child2 = iF;
+            F.Parent = iA;
+            A.Box = Union(B.Box, F.Box);
+            C.Box = Union(A.Box, G.Box);
+            A.Height = 1 + std::max(B.Height, F.Height);
+            C.Height = 1 + std::max(A.Height, G.Height);
+        }
+
+        return iC;
+    }
+
+    // Rotate B up
+    if (balance < -1)
+    {
+        int iD = B.Child1;
+        int iE = B.Child2;
+        Node& D = m_Nodes[iD];
+        Node& E = m_Nodes[iE];
+
+        B.Child1 = iA;
+        B.Parent = A.Parent;
+        A.Parent = iB;
+
+        if (B.Parent != NULL_NODE)
+        {
+            if (m_Nodes[B.Parent].Child1 == iA)
+                m_Nodes[B.Parent].Child1 = iB;
+            else
+                m_Nodes[B.Parent].Child2 = iB;
+        }
+        else
+        {
+            m_Root = iB;
+        }
+
+        if (D.Height > E.Height)
+        {
+            B.Child2 = iD;
+            A.Child1 = iE;
+            E.Parent = iA;
+            A.Box = Union(C.Box, E.Box);
+            B.Box = Union(A.Box, D.Box);
+            A.Height = 1 + std::max(C.Height, E.Height);
+            B.Height = 1 + std::max(A.Height, D.Height);
+        }
+        else
+        {
+            B.Child2 = iE;
+            A.Child1 = iD;
+            D.Parent = iA;
+            A.Box = Union(C.Box, D.Box);
+            B.Box = Union(A.Box, E.Box);
+            A.Height = 1 + std::max(C.Height, D.Height);
+            B.Height = 1 + std::max(A.Height, E.Height);
+        }
+
+        return iB;
+    }
+
+    return iA;
+}
@@ -1,91 +1,766 @@
 #include "Physics/Physics.h"
 #include "Physics/Collider.h"
+#include "Physics/RigidBody.h"
+#include "Physics/SpatialHash.h"
+#include "Physics/SweepAndPrune.h"
+#include "Physics/AABBTreeBroadphase.h"
+#include "Entities/Entity.h"
+#include "Core/JobSystem.h"
 #include <algorithm>
+#include <cassert>
+#include <cfloat>
+#include <cmath>
 
 std::vector<Collider*> Physics::s_Colliders;
+std::vector<Physics::ColliderSlot> Physics::s_Slots;
+uint32_t Physics::s_FreeSlot = ColliderHandle::INVALID_SLOT;
 bool Physics::s_DebugDraw = false;
 
-void Physics::Init()
+PhysicsSettings Physics::s_Settings;
+Physics::Partition Physics::s_Dynamic;
+Physics::Partition Physics::s_Static;
+bool Physics::s_BoundsDirty = true;
+std::vector<uint32_t> Physics::s_Candidates;
+BoundsSoA Physics::s_Bounds;
+std::vector<Physics::ContactPair> Physics::s_Contacts;
+std::vector<Physics::ContactPair> Physics::s_NewContacts;
+std::vector<Physics::CandidatePair> Physics::s_CandidatePairs;
+std::vector<std::vector<Physics::ContactPair>> Physics::s_ThreadContacts;
+std::vector<RigidBody*> Physics::s_Bodies;
+std::vector<Physics::BodyContact> Physics::s_BodyContacts;
+std::vector<Physics::BodyContact> Physics::s_LastBodyContacts;
+std::vector<float> Physics::s_IslandSleepTime;
+std::vector<uint8_t> Physics::s_IslandAwake;
+
+// Contact solver tuning (world units)
+static constexpr float RESTITUTION_SPEED = 20.0f;   // Slower impacts don't bounce
+static constexpr float POSITION_SLOP = 0.5f;        // Overlap left alone, so resting contacts persist
+static constexpr float POSITION_CORRECTION = 0.4f;  // Fraction of the remaining overlap removed per pass
+static constexpr int POSITION_ITERATIONS = 3;
+
+static std::unique_ptr<Broadphase> CreateBroadphase(const PhysicsSettings& settings)
 {
-    s_Colliders.clear();
+    switch (settings.Broadphase)
+    {
+    case BroadphaseType::SpatialHash:
+        return std::make_unique<SpatialHashBroadphase>(settings.CellSize);
+    case BroadphaseType::SweepAndPrune:
+        return std::make_unique<SweepAndPruneBroadphase>();
+    case BroadphaseType::AABBTree:
+        return std::make_unique<AABBTreeBroadphase>(settings.TreeMargin);
+    case BroadphaseType::BruteForce:
+    default:
+        return std::make_unique<BruteForceBroadphase>();
+    }
+}
+
+void Physics::Init(const PhysicsSettings& settings)
+{
+    ClearColliders();
     s_DebugDraw = false;
+    SetSettings(settings);
 }
 
 void Physics::Shutdown()
 {
+    ClearColliders();
+    s_Dynamic.Phase.reset();
+    s_Static.Phase.reset();
+    s_Candidates.clear();
+    s_Bounds.Resize(0);
+    s_NewContacts.clear();
+    s_CandidatePairs.clear();
+    s_ThreadContacts.clear();
+    s_BodyContacts.clear();
+    s_LastBodyContacts.clear();
+    s_IslandSleepTime.clear();
+    s_IslandAwake.clear();
+}
+
+void Physics::ClearColliders()
+{
+    for (Collider* collider : s_Colliders)
+        collider->m_Handle = ColliderHandle();
+
     s_Colliders.clear();
+    s_Slots.clear();
+
+    for (RigidBody* body : s_Bodies)
+        body->m_Registered = false;
+    s_Bodies.clear();
+    s_FreeSlot = ColliderHandle::INVALID_SLOT;
+
+    for (Partition* partition : { &s_Dynamic, &s_Static })
+    {
+        partition->Colliders.clear();
+        partition->GlobalIndex.clear();
+        partition->Dirty = true;
+    }
+    s_BoundsDirty = true;
+
+    // Slot generations restart, so old pairs could match new colliders
+    s_Contacts.clear();
+}
+
+void Physics::SetSettings(const PhysicsSettings& settings)
+{
+    s_Settings = settings;
+    s_Dynamic.Phase = CreateBroadphase(settings);
+    s_Dynamic.Dirty = true;
+    s_Static.Phase = CreateBroadphase(settings);
+    s_Static.Dirty = true;
+}
+
+void Physics::BeginFrame()
+{
+    s_Dynamic.Dirty = true;
+}
+
+void Physics::InvalidateStatic()
+{
+    s_Static.Dirty = true;
+}
+
+Physics::Partition& Physics::GetPartition(const Collider* collider)
+{
+    return collider->IsStatic() ? s_Static : s_Dynamic;
+}
+
+void Physics::AddToPartition(Collider* collider)
+{
+    Partition& partition = GetPartition(collider);
+    collider->m_PartitionIndex = (uint32_t)partition.Colliders.size();
+    partition.Colliders.push_back(collider);
+    partition.GlobalIndex.push_back(collider->m_PhysicsIndex);
+    partition.Dirty = true;
+}
+
+void Physics::RemoveFromPartition(Collider* collider)
+{
+    Partition& partition = GetPartition(collider);
+    uint32_t index = collider->m_PartitionIndex;
+    assert(index < partition.Colliders.size() && partition.Colliders[index] == collider);
+
+    // Swap and pop, as in the main list
+    Collider* last = partition.Colliders.back();
+    partition.Colliders[index] = last;
+    partition.GlobalIndex[index] = partition.GlobalIndex.back();
+    last->m_PartitionIndex = index;
+    partition.Colliders.pop_back();
+    partition.GlobalIndex.pop_back();
+    partition.Dirty = true;
+}
+
+bool Physics::ContactPair::operator<(const ContactPair& other) const
+{
+    if (A.Slot != other.A.Slot) return A.Slot < other.A.Slot;
+    if (B.Slot != other.B.Slot) return B.Slot < other.B.Slot;
+    if (A.Generation != other.A.Generation) return A.Generation < other.A.Generation;
+    return B.Generation < other.B.Generation;
+}
+
+void Physics::FindContacts(std::vector<ContactPair>& outPairs)
+{
+    outPairs.clear();
+
+    // Broadphase, on this thread (queries share scratch buffers). Only dynamic colliders
+    // ask, so static pairs never come up: each dynamic pair once from its lower index,
+    // and each dynamic/static pair from the dynamic side.
+    s_CandidatePairs.clear();
+    for (uint32_t i : s_Dynamic.GlobalIndex)
+    {
+        const Collider* collider = s_Colliders[i];
+        if (!collider->IsEnabled() || !collider->GetOwner() || IsResting(collider)) continue;
+
+        GatherCandidates(collider);
+
+        // Resting colliders don't ask, so pairs with them come from this side
+        for (uint32_t index : s_Candidates)
+        {
+            if (index > i || IsResting(s_Colliders[index]))
+                s_CandidatePairs.push_back({ i, index });
+        }
+    }
+
+    // Narrow phase across the job system. Tests only read collider state, and each
+    // thread appends to its own buffer, so no locking; the sort below makes the
+    // result independent of how the chunks were spread over threads.
+    s_ThreadContacts.resize(JobSystem::GetThreadCount());
+    for (std::vector<ContactPair>& contacts : s_ThreadContacts)
+        contacts.clear();
+
+    static constexpr size_t PAIRS_PER_CHUNK = 1024;
+    JobSystem::ParallelFor(s_CandidatePairs.size(), PAIRS_PER_CHUNK, [](size_t begin, size_t end, uint32_t thread)
+    {
+        std::vector<ContactPair>& contacts = s_ThreadContacts[thread];
+        for (size_t p = begin; p < end; p++)
+        {
+            const CandidatePair& pair = s_CandidatePairs[p];
+            if (TestCandidate(s_Colliders[pair.A], pair.B))
+                contacts.push_back(MakeContactPair(s_Colliders[pair.A], s_Colliders[pair.B]));
+        }
+    });
+
+    for (const std::vector<ContactPair>& contacts : s_ThreadContacts)
+        outPairs.insert(outPairs.end(), contacts.begin(), contacts.end());
+
+    // Bullets also touch the first thing in their path since the last tick
+    // (Sweep reuses the candidate list, so this can't share the loop above)
+    for (const Collider* collider : s_Colliders)
+    {
+        if (!collider->IsBullet() || !collider->IsEnabled() || IsResting(collider)) continue;
+
+        RaycastHit hit;
+        if (Sweep(collider, collider->m_SweepStart, collider->GetWorldPosition(), hit))
+            outPairs.push_back(MakeContactPair(collider, hit.HitCollider));
+    }
+
+    // Pairs of resting colliders weren't tested: they still touch if they did last tick
+    // (unless both are static, as those pairs never count)
+    for (const ContactPair& pair : s_Contacts)
+    {
+        const Collider* a = GetCollider(pair.A);
+        const Collider* b = GetCollider(pair.B);
+        if (!a || !b || !a->IsEnabled() || !b->IsEnabled()) continue;
+        if (a->IsStatic() && b->IsStatic()) continue;
+
+        if (IsResting(a) && IsResting(b))
+            outPairs.push_back(pair);
+    }
+
+    std::sort(outPairs.begin(), outPairs.end());
+    outPairs.erase(std::unique(outPairs.begin(), outPairs.end()), outPairs.end());
+}
+
+Physics::ContactPair Physics::MakeContactPair(const Collider* a, const Collider* b)
+{
+    if (b->m_Handle.Slot < a->m_Handle.Slot) std::swap(a, b);
+    return { a->m_Handle, b->m_Handle };
+}
+
+void Physics::DispatchContact(const ContactPair& pair, ContactEvent event)
+{
+    // Look the colliders up again before each call: the previous callback may have
+    // unregistered either of them
+    for (int side = 0; side < 2; side++)
+    {
+        Collider* self = GetCollider(side == 0 ? pair.A : pair.B);
+        Collider* other = GetCollider(side == 0 ? pair.B : pair.A);
+        if (!self || !other || !self->GetOwner() || !other->GetOwner()) return;
+
+        Entity* entity = self->GetOwner();
+        switch (event)
+        {
+        case ContactEvent::Enter: entity->OnCollisionEnter(other->GetOwner()); break;
+        case ContactEvent::Stay:  entity->OnCollisionStay(other->GetOwner()); break;
+        case ContactEvent::Exit:  entity->OnCollisionExit(other->GetOwner()); break;
+        }
+    }
+}
+
+void Physics::Step(float fixedDeltaTime)
+{
+    // Gravity first, so the solver can cancel it for bodies that are supported
+    IntegrateVelocities(fixedDeltaTime);
+
+    // Colliders moved during the tick
+    s_Dynamic.Dirty = true;
+    SyncBroadphase();
+
+    FindContacts(s_NewContacts);
+
+    SolveVelocities(s_NewContacts);
+    IntegratePositions(fixedDeltaTime);
+    SolvePositions();
+    UpdateSleep(s_NewContacts, fixedDeltaTime);
+
+    // Merge the two sorted lists: only in the old one = Exit, only in the new one
+    // = Enter, in both = Stay. Pairs whose collider was unregistered end silently.
+    const std::vector<ContactPair>& previous = s_Contacts;
+    const std::vector<ContactPair>& current = s_NewContacts;
+
+    size_t i = 0;
+    size_t j = 0;
+    while (i < previous.size() || j < current.size())
+    {
+        if (j >= current.size() || (i < previous.size() && previous[i] < current[j]))
+        {
+            // Whatever was resting on this contact may have to move again
+            WakeBodies(previous[i]);
+            DispatchContact(previous[i++], ContactEvent::Exit);
+        }
+        else if (i >= previous.size() || current[j] < previous[i])
+        {
+            DispatchContact(current[j++], ContactEvent::Enter);
+        }
+        else
+        {
+            DispatchContact(current[j], ContactEvent::Stay);
+            i++;
+            j++;
+        }
+    }
+
+    // Both lists keep their capacity, so steady state ticks don't allocate
+    s_Contacts.swap(s_NewContacts);
+
+    // Next tick's sweeps start here
+    for (Collider* collider : s_Colliders)
+    {
+        if (collider->IsBullet())
+            collider->m_SweepStart = collider->GetWorldPosition();
+    }
+}
+
+bool Physics::Sweep(const Collider* collider, const glm::vec2& from, const glm::vec2& to, RaycastHit& outHit)
+{
+    outHit = RaycastHit();
+    if (!collider || !collider->IsEnabled() || !collider->GetOwner()) return false;
+
+    SyncBroadphase();
+
+    // Everything the collider's box could touch on the way
+    glm::vec2 halfSize = collider->GetWorldBounds().GetSize() * 0.5f;
+    AABB swept(glm::min(from, to) - halfSize, glm::max(from, to) + halfSize);
+
+    s_Candidates.clear();
+    QueryPartition(s_Dynamic, swept, NO_PARTITION_INDEX);
+    if (!collider->IsStatic())
+        QueryPartition(s_Static, swept, NO_PARTITION_INDEX);
+    size_t kept = FilterOverlaps(s_Bounds, swept, collider->GetCategory(), collider->GetMask(),
+                                 s_Candidates.data(), s_Candidates.size());
+    s_Candidates.resize(kept);
+
+    // List order, so equal times of impact resolve the same way every run
+    std::sort(s_Candidates.begin(), s_Candidates.end());
+
+    for (uint32_t index : s_Candidates)
+    {
+        Collider* other = s_Colliders[index];
+        if (other == collider || !other->IsEnabled()) continue;
+        if (s_Bounds.Flags[index] & BoundsSoA::FLAG_NO_OWNER) continue;
+
+        RaycastHit hit;
+        if (!collider->Sweep(other, from, to, outHit.Fraction, hit)) continue;
+        if (outHit.HitCollider && hit.Fraction >= outHit.Fraction) continue;
+
+        hit.HitCollider = other;
+        outHit = hit;
+    }
+
+    return outHit.HitCollider != nullptr;
+}
+
+void Physics::SyncBroadphase()
+{
+    if (!s_Dynamic.Phase) return;
+    if (!s_Dynamic.Dirty && !s_Static.Dirty && !s_BoundsDirty) return;
+
+    // Static colliders don't move, so their bounds only need refreshing when
+    // they change or the list is reshuffled
+    bool refreshAll = s_Static.Dirty || s_BoundsDirty;
+
+    if (s_Static.Dirty)
+    {
+        s_Static.Phase->Build(s_Static.Colliders);
+        s_Static.Dirty = false;
+    }
+    if (s_Dynamic.Dirty)
+    {
+        s_Dynamic.Phase->Build(s_Dynamic.Colliders);
+        s_Dynamic.Dirty = false;
+    }
+
+    // Snapshot the bounds once, so queries this tick don't have to go through
+    // collider -> owner for each candidate
+    s_Bounds.Resize(s_Colliders.size());
+    if (refreshAll)
+    {
+        for (uint32_t i = 0; i < (uint32_t)s_Colliders.size(); i++)
+            SnapshotBounds(i);
+        s_BoundsDirty = false;
+    }
+    else
+    {
+        for (uint32_t i : s_Dynamic.GlobalIndex)
+            SnapshotBounds(i);
+    }
+}
+
+void Physics::SnapshotBounds(uint32_t index)
+{
+    const Collider* collider = s_Colliders[index];
+
+    uint32_t flags = 0;
+    if (collider->GetType() != ColliderType::Box) flags |= BoundsSoA::FLAG_CIRCLE;
+    if (!collider->GetOwner()) flags |= BoundsSoA::FLAG_NO_OWNER;
+    s_Bounds.Set(index, collider->GetWorldBounds(), flags, collider->GetCategory(), collider->GetMask());
+}
+
+void Physics::QueryPartition(const Partition& partition, const AABB& bounds, uint32_t selfIndex)
+{
+    size_t first = s_Candidates.size();
+
+    if (selfIndex != NO_PARTITION_INDEX)
+        partition.Phase->QueryCollider(selfIndex, bounds, s_Candidates);
+    else
+        partition.Phase->Query(bounds, s_Candidates);
+
+    for (size_t i = first; i < s_Candidates.size(); i++)
+        s_Candidates[i] = partition.GlobalIndex[s_Candidates[i]];
+}
+
+void Physics::GatherCandidates(const Collider* collider)
+{
+    SyncBroadphase();
+
+    s_Candidates.clear();
+
+    AABB bounds = collider->GetWorldBounds();
+
+    // Registering/unregistering marks the partition dirty, so after the sync
+    // above a registered collider's index matches the last build
+    uint32_t selfIndex = collider->IsRegistered() ? collider->m_PartitionIndex : NO_PARTITION_INDEX;
+    QueryPartition(s_Dynamic, bounds, collider->IsStatic() ? NO_PARTITION_INDEX : selfIndex);
+
+    // Static colliders never collide with each other
+    if (!collider->IsStatic())
+        QueryPartition(s_Static, bounds, NO_PARTITION_INDEX);
+
+    // Drop candidates whose bounds miss (broadphases are conservative) or whose
+    // layers rule the pair out, before any narrow phase work
+    size_t kept = FilterOverlaps(s_Bounds, bounds, collider->GetCategory(), collider->GetMask(),
+                                 s_Candidates.data(), s_Candidates.size());
+    s_Candidates.resize(kept);
+
+    // Keep results in collider list order, as the brute-force loop returned them
+    std::sort(s_Candidates.begin(), s_Candidates.end());
+}
+
+bool Physics::TestCandidate(const Collider* collider, uint32_t index)
+{
+    Collider* other = s_Colliders[index];
+    if (other == collider || !other->IsEnabled()) return false;
+
+    uint32_t flags = s_Bounds.Flags[index];
+    if ((flags & BoundsSoA::FLAG_NO_OWNER) || !collider->GetOwner()) return false;
+
+    // Two boxes overlap exactly when their bounds do, which the filter already checked
+    if (!(flags & BoundsSoA::FLAG_CIRCLE) && collider->GetType() == ColliderType::Box)
+        return true;
+
+    return collider->CheckCollision(other);
 }
 
 void Physics::RegisterCollider(Collider* collider)
 {
     if (!collider) return;
-    
-    // Don't add duplicates
-    auto it = std::find(s_Colliders.begin(), s_Colliders.end(), collider);
-    if (it == s_Colliders.end())
+
+    assert(!collider->IsRegistered() && "Collider registered twice");
+    if (collider->IsRegistered()) return;
+
+    uint32_t slot = s_FreeSlot;
+    if (slot != ColliderHandle::INVALID_SLOT)
+    {
+        s_FreeSlot = s_Slots[slot].NextFree;
+    }
+    else
     {
-        s_Colliders.push_back(collider);
+        slot = (uint32_t)s_Slots.size();
+        s_Slots.emplace_back();
     }
+
+    s_Slots[slot].Owner = collider;
+    collider->m_Handle = { slot, s_Slots[slot].Generation };
+    collider->m_PhysicsIndex = (uint32_t)s_Colliders.size();
+    collider->m_SweepStart = collider->GetWorldPosition();
+
+    s_Colliders.push_back(collider);
+    AddToPartition(collider);
+    s_BoundsDirty = true;
 }
 
 void Physics::UnregisterCollider(Collider* collider)
 {
-    if (!collider) return;
-    
-    auto it = std::find(s_Colliders.begin(), s_Colliders.end(), collider);
-    if (it != s_Colliders.end())
+    if (!collider || !collider->IsRegistered()) return;
+
+    uint32_t index = collider->m_PhysicsIndex;
+    assert(index < s_Colliders.size() && s_Colliders[index] == collider);
+
+    RemoveFromPartition(collider);
+
+    // Swap and pop: the last collider takes over the freed index
+    Collider* last = s_Colliders.back();
+    s_Colliders[index] = last;
+    last->m_PhysicsIndex = index;
+    s_Colliders.pop_back();
+    if (last != collider)
+        GetPartition(last).GlobalIndex[last->m_PartitionIndex] = index;
+
+    ColliderSlot& slot = s_Slots[collider->m_Handle.Slot];
+    slot.Owner = nullptr;
+    slot.Generation++;
+    slot.NextFree = s_FreeSlot;
+    s_FreeSlot = collider->m_Handle.Slot;
+
+    collider->m_Handle = ColliderHandle();
+    s_BoundsDirty = true;  // Indices changed, and the collider may be about to be freed
+}
+
+Collider* Physics::GetCollider(ColliderHandle handle)
+{
+    if (handle.Slot >= s_Slots.size()) return nullptr;
+
+    const ColliderSlot& slot = s_Slots[handle.Slot];
+    return slot.Generation == handle.Generation ? slot.Owner : nullptr;
+}
+
+template<typename Callback>
+void Physics::ForEachInRegion(const AABB& bounds, uint32_t layerMask, Callback&& callback)
+{
+    SyncBroadphase();
+    if (!s_Dynamic.Phase) return;
+
+    s_Candidates.clear();
+    QueryPartition(s_Dynamic, bounds, NO_PARTITION_INDEX);
+    QueryPartition(s_Static, bounds, NO_PARTITION_INDEX);
+
+    // The region takes the layers in layerMask and is accepted by any collider whose
+    // mask isn't empty
+    size_t kept = FilterOverlaps(s_Bounds, bounds, COLLISION_ALL_LAYERS, layerMask,
+                                 s_Candidates.data(), s_Candidates.size());
+    s_Candidates.resize(kept);
+    std::sort(s_Candidates.begin(), s_Candidates.end());
+
+    for (uint32_t index : s_Candidates)
     {
-        s_Colliders.erase(it);
+        Collider* collider = s_Colliders[index];
+        uint32_t flags = s_Bounds.Flags[index];
+        if (!collider->IsEnabled() || (flags & BoundsSoA::FLAG_NO_OWNER)) continue;
+
+        if (!callback(collider, flags))
+            return;
     }
 }
 
-bool Physics::CheckCollision(const Collider* collider, Collider** outOther)
+bool Physics::BeginCollisionQuery(const Collider* collider)
 {
     if (!collider || !collider->IsEnabled()) return false;
 
-    for (Collider* other : s_Colliders)
-    {
-        if (other == collider) continue;
-        if (!other->IsEnabled()) continue;
+    GatherCandidates(collider);
+    return true;
+}
 
-        if (collider->CheckCollision(other))
-        {
-            if (outOther)
-                *outOther = other;
-            return true;
-        }
-    }
+bool Physics::CheckCollision(const Collider* collider, Collider** outOther)
+{
+    Collider* first = nullptr;
+    ForEachCollision(collider, [&](Collider* other)
+    {
+        first = other;
+        return false;
+    });
 
-    return false;
+    if (first && outOther)
+        *outOther = first;
+    return first != nullptr;
 }
 
 std::vector<Collider*> Physics::GetCollisions(const Collider* collider)
 {
     std::vector<Collider*> collisions;
-    
-    if (!collider || !collider->IsEnabled()) 
-        return collisions;
+    ForEachCollision(collider, [&](Collider* other)
+    {
+        collisions.push_back(other);
+        return true;
+    });
+    return collisions;
+}
+
+size_t Physics::GetCollisions(const Collider* collider, Collider** outColliders, size_t capacity)
+{
+    size_t count = 0;
+    if (capacity == 0) return 0;
+
+    ForEachCollision(collider, [&](Collider* other)
+    {
+        outColliders[count++] = other;
+        return count < capacity;
+    });
+    return count;
+}
+
+size_t Physics::QueryAABB(const AABB& bounds, Collider** outColliders, size_t capacity, uint32_t layerMask)
+{
+    size_t count = 0;
+    if (capacity == 0) return 0;
+
+    ForEachInRegion(bounds, layerMask, [&](Collider* collider, uint32_t flags)
+    {
+        // A box covers exactly its bounds, which already overlap the region
+        if ((flags & BoundsSoA::FLAG_CIRCLE) && !collider->OverlapsBox(bounds))
+            return true;
+
+        outColliders[count++] = collider;
+        return count < capacity;
+    });
+    return count;
+}
+
+size_t Physics::QueryCircle(const glm::vec2& center, float radius, Collider** outColliders, size_t capacity,
+                            uint32_t layerMask)
+{
+    size_t count = 0;
+    if (capacity == 0) return 0;
+
+    AABB bounds = AABB::FromCenter(center, glm::vec2(radius * 2.0f));
+    ForEachInRegion(bounds, layerMask, [&](Collider* collider, uint32_t)
+    {
+        if (!collider->OverlapsCircle(center, radius))
+            return true;
+
+        outColliders[count++] = collider;
+        return count < capacity;
+    });
+    return count;
+}
+
+size_t Physics::QueryPoint(const glm::vec2& point, Collider** outColliders, size_t capacity, uint32_t layerMask)
+{
+    return QueryAABB(AABB(point, point), outColliders, capacity, layerMask);
+}
+
+// Narrow phase for one ray: keeps the nearest hit among the broadphase candidates
+class NearestHitVisitor : public RaycastVisitor
+{
+public:
+    NearestHitVisitor(const std::vector<Collider*>& colliders, const glm::vec2& start,
+                      const glm::vec2& end, uint32_t layerMask, const RaycastFilter& filter)
+        : m_Colliders(colliders), m_Start(start), m_End(end), m_LayerMask(layerMask), m_Filter(filter) {}
 
-    for (Collider* other : s_Colliders)
+    float Visit(uint32_t index, float maxFraction) override
     {
-        if (other == collider) continue;
-        if (!other->IsEnabled()) continue;
+        // May visit several broadphases in turn: never go past the best hit so far
+        if (Hit.HitCollider) maxFraction = std::min(maxFraction, Hit.Fraction);
+
+        Collider* collider = m_Colliders[index];
+        if (!collider->IsEnabled()) return -1.0f;
+        if (!(collider->GetCategory() & m_LayerMask)) return -1.0f;
+        if (m_Filter && !m_Filter(collider)) return -1.0f;
+
+        RaycastHit hit;
+        if (!collider->Raycast(m_Start, m_End, maxFraction, hit))
+            return -1.0f;
+
+        hit.HitCollider = collider;
+        Hit = hit;
+        return hit.Fraction;
+    }
+
+    RaycastHit Hit;
+
+private:
+    const std::vector<Collider*>& m_Colliders;
+    glm::vec2 m_Start;
+    glm::vec2 m_End;
+    uint32_t m_LayerMask;
+    const RaycastFilter& m_Filter;
+};
+
+// Maps a partition's broadphase indices back to the collider list
+class PartitionRaycastVisitor : public RaycastVisitor
+{
+public:
+    PartitionRaycastVisitor(RaycastVisitor& visitor, const std::vector<uint32_t>& globalIndex)
+        : m_Visitor(visitor), m_GlobalIndex(globalIndex) {}
+
+    float Visit(uint32_t index, float maxFraction) override
+    {
+        return m_Visitor.Visit(m_GlobalIndex[index], maxFraction);
+    }
 
-        if (collider->CheckCollision(other))
+private:
+    RaycastVisitor& m_Visitor;
+    const std::vector<uint32_t>& m_GlobalIndex;
+};
+
+bool Physics::CastRay(const glm::vec2& start, const glm::vec2& end, RaycastHit& outHit,
+                      uint32_t layerMask, const RaycastFilter& filter)
+{
+    NearestHitVisitor visitor(s_Colliders, start, end, layerMask, filter);
+
+    if (s_Dynamic.Phase)
+    {
+        for (const Partition* partition : { &s_Dynamic, &s_Static })
         {
-            collisions.push_back(other);
+            PartitionRaycastVisitor mapped(visitor, partition->GlobalIndex);
+            partition->Phase->Raycast(start, end, mapped);
+        }
+    }
+    else
+    {
+        float maxFraction = 1.0f;
+        for (uint32_t i = 0; i < (uint32_t)s_Colliders.size(); i++)
+        {
+            float value = visitor.Visit(i, maxFraction);
+            if (value == 0.0f) break;
+            if (value > 0.0f) maxFraction = value;
         }
     }
 
-    return collisions;
+    outHit = visitor.Hit;
+    return outHit.HitCollider != nullptr;
 }
 
-bool Physics::Raycast(const glm::vec2& start, const glm::vec2& end, 
+bool Physics::Raycast(const glm::vec2& start, const glm::vec2& end,
                      Collider** outHit, glm::vec2* outPoint)
 {
-    // TODO: Implement proper raycast
-    // For now, just return false
-    return false;
+    RaycastHit hit;
+    if (!Raycast(start, end, hit))
+        return false;
+
+    if (outHit)
+        *outHit = hit.HitCollider;
+    if (outPoint)
+        *outPoint = hit.Point;
+    return true;
+}
+
+bool Physics::Raycast(const glm::vec2& start, const glm::vec2& end, RaycastHit& outHit,
+                      uint32_t layerMask, const RaycastFilter& filter)
+{
+    SyncBroadphase();
+    return CastRay(start, end, outHit, layerMask, filter);
+}
+
+size_t Physics::RaycastMany(const std::vector<Ray>& rays, std::vector<RaycastHit>& outHits,
+                            bool parallel, uint32_t layerMask, const RaycastFilter& filter)
+{
+    // Build once up front; after this the casts only read shared state
+    SyncBroadphase();
+
+    outHits.resize(rays.size());
+
+    auto castRange = [&](size_t begin, size_t end, uint32_t)
+    {
+        for (size_t i = begin; i < end; i++)
+            CastRay(rays[i].Start, rays[i].End, outHits[i], layerMask, filter);
+    };
+
+    // Below this many rays per chunk, handing work to another thread costs more than it saves
+    static constexpr size_t MIN_RAYS_PER_CHUNK = 64;
+
+    if (parallel)
+        JobSystem::ParallelFor(rays.size(), MIN_RAYS_PER_CHUNK, castRange);
+    else
+        castRange(0, rays.size(), 0);
+
+    size_t hitCount = 0;
+    for (const RaycastHit& hit : outHits)
+    {
+        if (hit.HitCollider)
+            hitCount++;
+    }
+    return hitCount;
 }
 
 void Physics::DebugRenderColliders()
@@ -99,4 +774,296 @@ void Physics::DebugRenderColliders()
         collider->DebugRender();
     }
 
-}
\ No newline at end of file
+}
+
+// ============================================
+// Rigid bodies
+// ============================================
+
+RigidBody* Physics::GetBody(const Collider* collider)
+{
+    Entity* owner = collider->GetOwner();
+    return owner ? owner->GetRigidBody() : nullptr;
+}
+
+bool Physics::IsResting(const Collider* collider)
+{
+    if (collider->IsStatic()) return true;
+
+    const RigidBody* body = GetBody(collider);
+    return body && !body->IsAwake();
+}
+
+void Physics::IntegrateVelocities(float dt)
+{
+    glm::vec2 gravity = s_Settings.Gravity * dt;
+
+    for (RigidBody* body : s_Bodies)
+    {
+        if (!body->m_Awake || body->m_InverseMass == 0.0f) continue;
+
+        body->m_Velocity += gravity * body->m_GravityScale;
+        body->m_Velocity *= 1.0f / (1.0f + dt * body->m_LinearDamping);
+    }
+}
+
+void Physics::IntegratePositions(float dt)
+{
+    for (RigidBody* body : s_Bodies)
+    {
+        if (!body->m_Awake || !body->m_Owner) continue;
+
+        Entity* owner = body->m_Owner;
+        owner->SetPosition(owner->GetPosition() + body->m_Velocity * dt);
+    }
+}
+
+void Physics::SolveVelocities(const std::vector<ContactPair>& pairs)
+{
+    auto relativeVelocity = [](const BodyContact& contact)
+    {
+        glm::vec2 velocityA = contact.A ? contact.A->m_Velocity : glm::vec2(0.0f);
+        glm::vec2 velocityB = contact.B ? contact.B->m_Velocity : glm::vec2(0.0f);
+        return velocityB - velocityA;
+    };
+
+    auto applyImpulse = [](const BodyContact& contact, const glm::vec2& impulse)
+    {
+        if (contact.A) contact.A->m_Velocity -= impulse * contact.A->m_InverseMass;
+        if (contact.B) contact.B->m_Velocity += impulse * contact.B->m_InverseMass;
+    };
+
+    // One entry per solid pair with something to push. Both lists are sorted, so
+    // last Step's impulses are found by walking along the old one.
+    s_LastBodyContacts.swap(s_BodyContacts);
+    s_BodyContacts.clear();
+    size_t last = 0;
+
+    for (const ContactPair& pair : pairs)
+    {
+        Collider* a = GetCollider(pair.A);
+        Collider* b = GetCollider(pair.B);
+        if (!a || !b || a->IsTrigger() || b->IsTrigger()) continue;
+
+        RigidBody* bodyA = GetBody(a);
+        RigidBody* bodyB = GetBody(b);
+        float inverseMassA = bodyA ? bodyA->m_InverseMass : 0.0f;
+        float inverseMassB = bodyB ? bodyB->m_InverseMass : 0.0f;
+        if (inverseMassA + inverseMassB == 0.0f) continue;
+
+        // Carried over resting pairs stay as they are
+        bool awakeA = bodyA && bodyA->m_Awake;
+        bool awakeB = bodyB && bodyB->m_Awake;
+        if (!awakeA && !awakeB) continue;
+
+        Penetration penetration;
+        if (!a->GetPenetration(b, penetration)) continue;
+
+        // Something awake ran into a sleeping body
+        if (bodyA && !awakeA) bodyA->WakeUp();
+        if (bodyB && !awakeB) bodyB->WakeUp();
+
+        BodyContact contact;
+        contact.Pair = pair;
+        contact.ColliderA = a;
+        contact.ColliderB = b;
+        contact.A = bodyA;
+        contact.B = bodyB;
+        contact.Normal = penetration.Normal;
+        contact.NormalMass = 1.0f / (inverseMassA + inverseMassB);
+        contact.NormalImpulse = 0.0f;
+        contact.TangentImpulse = 0.0f;
+
+        // Bounciest side wins; friction is the geometric mean (or the only body's own)
+        float restitution = std::max(bodyA ? bodyA->m_Restitution : 0.0f, bodyB ? bodyB->m_Restitution : 0.0f);
+        if (bodyA && bodyB)
+            contact.Friction = std::sqrt(bodyA->m_Friction * bodyB->m_Friction);
+        else
+            contact.Friction = bodyA ? bodyA->m_Friction : bodyB->m_Friction;
+
+        float approach = glm::dot(relativeVelocity(contact), contact.Normal);
+        contact.Bias = approach < -RESTITUTION_SPEED ? -restitution * approach : 0.0f;
+
+        // Warm start from the same pair last Step (if it's still pushing the same way),
+        // so stacks converge over a few Steps instead of needing many iterations each
+        while (last < s_LastBodyContacts.size() && s_LastBodyContacts[last].Pair < pair)
+            last++;
+        if (last < s_LastBodyContacts.size() && s_LastBodyContacts[last].Pair == pair &&
+            glm::dot(s_LastBodyContacts[last].Normal, contact.Normal) > 0.99f)
+        {
+            contact.NormalImpulse = s_LastBodyContacts[last].NormalImpulse;
+            contact.TangentImpulse = s_LastBodyContacts[last].TangentImpulse;
+        }
+
+        s_BodyContacts.push_back(contact);
+    }
+
+    for (const BodyContact& contact : s_BodyContacts)
+    {
+        glm::vec2 tangent(-contact.Normal.y, contact.Normal.x);
+        applyImpulse(contact, contact.Normal * contact.NormalImpulse + tangent * contact.TangentImpulse);
+    }
+
+    // Sequential impulses: totals are accumulated per contact and clamped, so later
+    // passes can take back what earlier ones overdid
+    for (int iteration = 0; iteration < s_Settings.VelocityIterations; iteration++)
+    {
+        for (BodyContact& contact : s_BodyContacts)
+        {
+            float impulse = contact.NormalMass * (contact.Bias - glm::dot(relativeVelocity(contact), contact.Normal));
+            float total = std::max(contact.NormalImpulse + impulse, 0.0f);
+            applyImpulse(contact, contact.Normal * (total - contact.NormalImpulse));
+            contact.NormalImpulse = total;
+
+            // Friction, at most Friction * the normal impulse either way
+            glm::vec2 tangent(-contact.Normal.y, contact.Normal.x);
+            float maxFriction = contact.Friction * contact.NormalImpulse;
+            float tangentImpulse = -contact.NormalMass * glm::dot(relativeVelocity(contact), tangent);
+            float tangentTotal = glm::clamp(contact.TangentImpulse + tangentImpulse, -maxFriction, maxFriction);
+            applyImpulse(contact, tangent * (tangentTotal - contact.TangentImpulse));
+            contact.TangentImpulse = tangentTotal;
+        }
+    }
+
+}
+
+void Physics::SolvePositions()
+{
+    // Push overlapping bodies apart, split by inverse mass. Depths are measured again
+    // each pass, so a correction is seen by the contacts after it.
+    for (int iteration = 0; iteration < POSITION_ITERATIONS; iteration++)
+    {
+        for (const BodyContact& contact : s_BodyContacts)
+        {
+            Penetration penetration;
+            if (!contact.ColliderA->GetPenetration(contact.ColliderB, penetration)) continue;
+
+            float depth = penetration.Depth - POSITION_SLOP;
+            if (depth <= 0.0f) continue;
+
+            glm::vec2 correction = penetration.Normal * (depth * POSITION_CORRECTION * contact.NormalMass);
+            if (contact.A)
+            {
+                Entity* owner = contact.A->m_Owner;
+                owner->SetPosition(owner->GetPosition() - correction * contact.A->m_InverseMass);
+            }
+            if (contact.B)
+            {
+                Entity* owner = contact.B->m_Owner;
+                owner->SetPosition(owner->GetPosition() + correction * contact.B->m_InverseMass);
+            }
+        }
+    }
+}
+
+uint32_t Physics::FindIsland(uint32_t body)
+{
+    while (s_Bodies[body]->m_Island != body)
+    {
+        // Path halving
+        uint32_t parent = s_Bodies[body]->m_Island;
+        s_Bodies[body]->m_Island = s_Bodies[parent]->m_Island;
+        body = s_Bodies[body]->m_Island;
+    }
+    return body;
+}
+
+void Physics::UpdateSleep(const std::vector<ContactPair>& pairs, float dt)
+{
+    float sleepSpeed2 = s_Settings.SleepSpeed * s_Settings.SleepSpeed;
+
+    for (uint32_t i = 0; i < (uint32_t)s_Bodies.size(); i++)
+    {
+        RigidBody* body = s_Bodies[i];
+        body->m_Island = i;
+        if (!body->m_Awake) continue;
+
+        if (!body->m_SleepingAllowed || glm::dot(body->m_Velocity, body->m_Velocity) > sleepSpeed2)
+            body->m_SleepTime = 0.0f;
+        else
+            body->m_SleepTime += dt;
+    }
+
+    // Islands: bodies joined by solid contacts. Immovable colliders and kinematic bodies
+    // don't join them, or everything resting on the same floor could only sleep at once.
+    for (const ContactPair& pair : pairs)
+    {
+        Collider* a = GetCollider(pair.A);
+        Collider* b = GetCollider(pair.B);
+        if (!a || !b || a->IsTrigger() || b->IsTrigger()) continue;
+
+        RigidBody* bodyA = GetBody(a);
+        RigidBody* bodyB = GetBody(b);
+        if (!bodyA || !bodyB || bodyA->m_InverseMass == 0.0f || bodyB->m_InverseMass == 0.0f) continue;
+
+        uint32_t rootA = FindIsland(bodyA->m_PhysicsIndex);
+        uint32_t rootB = FindIsland(bodyB->m_PhysicsIndex);
+        s_Bodies[std::max(rootA, rootB)]->m_Island = std::min(rootA, rootB);
+    }
+
+    // An island falls asleep once all its bodies have been slow for long enough, and
+    // wakes as a whole when any of them is awake but not ready to sleep
+    s_IslandSleepTime.assign(s_Bodies.size(), FLT_MAX);
+    s_IslandAwake.assign(s_Bodies.size(), 0);
+    for (uint32_t i = 0; i < (uint32_t)s_Bodies.size(); i++)
+    {
+        uint32_t root = FindIsland(i);
+        s_IslandSleepTime[root] = std::min(s_IslandSleepTime[root], s_Bodies[i]->m_SleepTime);
+        if (s_Bodies[i]->m_Awake) s_IslandAwake[root] = 1;
+    }
+
+    for (uint32_t i = 0; i < (uint32_t)s_Bodies.size(); i++)
+    {
+        RigidBody* body = s_Bodies[i];
+        uint32_t root = FindIsland(i);
+        if (!s_IslandAwake[root]) continue;
+
+        if (s_IslandSleepTime[root] >= s_Settings.TimeToSleep)
+        {
+            body->m_Awake = false;
+            body->m_Velocity = glm::vec2(0.0f);
+        }
+        else if (!body->m_Awake)
+        {
+            body->WakeUp();
+        }
+    }
+}
+
+void Physics::WakeBodies(const ContactPair& pair)
+{
+    for (ColliderHandle handle : { pair.A, pair.B })
+    {
+        Collider* collider = GetCollider(handle);
+        RigidBody* body = collider ? GetBody(collider) : nullptr;
+        if (body && !body->m_Awake) body->WakeUp();
+    }
+}
+
+void Physics::RegisterBody(RigidBody* body)
+{
+    if (!body) return;
+
+    assert(!body->m_Registered && "Rigid body registered twice");
+    if (body->m_Registered) return;
+
+    body->m_PhysicsIndex = (uint32_t)s_Bodies.size();
+    body->m_Registered = true;
+    s_Bodies.push_back(body);
+}
+
+void Physics::UnregisterBody(RigidBody* body)
+{
+    if (!body || !body->m_Registered) return;
+
+    uint32_t index = body->m_PhysicsIndex;
+    assert(index < s_Bodies.size() && s_Bodies[index] == body);
+
+    // Swap and pop, as for colliders
+    RigidBody* last = s_Bodies.back();
+    s_Bodies[index] = last;
+    last->m_PhysicsIndex = index;
+    s_Bodies.pop_back();
+
+    body->m_Registered = false;
+}
@@ -0,0 +1,51 @@
+#include "Physics/RigidBody.h"
+
+RigidBody::RigidBody(Entity* owner, float mass)
+    : m_Owner(owner)
+    , m_Velocity(0.0f, 0.0f)
+    , m_InverseMass(0.0f)
+    , m_Restitution(0.0f)
+    , m_Friction(0.4f)
+    , m_GravityScale(1.0f)
+    , m_LinearDamping(0.0f)
+    , m_Awake(true)
+    , m_SleepingAllowed(true)
+    , m_SleepTime(0.0f)
+    , m_Registered(false)
+    , m_PhysicsIndex(0)
+    , m_Island(0)
+{
+    SetMass(mass);
+}
+
+void RigidBody::SetVelocity(const glm::vec2& velocity)
+{
+    if (velocity != glm::vec2(0.0f))
+        WakeUp();
+
+    m_Velocity = velocity;
+}
+
+void RigidBody::ApplyImpulse(const glm::vec2& impulse)
+{
+    WakeUp();
+    m_Velocity += impulse * m_InverseMass;
+}
+
+void RigidBody::SetMass(float mass)
+{
+    m_InverseMass = mass > 0.0f ? 1.0f / mass : 0.0f;
+}
+
+void RigidBody::WakeUp()
+{
+    m_Awake = true;
+    m_SleepTime = 0.0f;
+}
+
+void RigidBody::SetSleepingAllowed(bool allowed)
+{
+    m_SleepingAllowed = allowed;
+    if (!allowed)
+        WakeUp();
+}
@@ -0,0 +1,233 @@
+#include "Physics/SpatialHash.h"
+#include "Physics/Collider.h"
+
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+// Colliders spanning more cells than this go to a list that every query checks
+static constexpr int MAX_CELLS_PER_COLLIDER = 64;
+
+static uint64_t CellKey(int x, int y)
+{
+    return ((uint64_t)(uint32_t)x << 32) | (uint64_t)(uint32_t)y;
+}
+
+// Spread neighbouring keys over the table (splitmix64 finalizer)
+static uint64_t MixKey(uint64_t key)
+{
+    key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ull;
+    key = (key ^ (key >> 27)) * 0x94d049bb133111ebull;
+    return key ^ (key >> 31);
+}
+
+SpatialHashBroadphase::SpatialHashBroadphase(float cellSize)
+    : m_QueryCounter(0)
+{
+    SetCellSize(cellSize);
+}
+
+void SpatialHashBroadphase::SetCellSize(float cellSize)
+{
+    m_CellSize = std::max(cellSize, 1.0f);
+    m_InvCellSize = 1.0f / m_CellSize;
+}
+
+glm::ivec2 SpatialHashBroadphase::ToCell(const glm::vec2& position) const
+{
+    return glm::ivec2((int)std::floor(position.x * m_InvCellSize),
+                      (int)std::floor(position.y * m_InvCellSize));
+}
+
+void SpatialHashBroadphase::Build(const std::vector<Collider*>& colliders)
+{
+    // Containers keep their capacity between rebuilds
+    m_Bounds.resize(colliders.size());
+    m_Entries.clear();
+    m_Oversized.clear();
+
+    for (uint32_t i = 0; i < (uint32_t)colliders.size(); i++)
+    {
+        const AABB& bounds = m_Bounds[i] = colliders[i]->GetWorldBounds();
+
+        glm::ivec2 minCell = ToCell(bounds.Min);
+        glm::ivec2 maxCell = ToCell(bounds.Max);
+
+        int cellCount = (maxCell.x - minCell.x + 1) * (maxCell.y - minCell.y + 1);
+        if (cellCount > MAX_CELLS_PER_COLLIDER)
+        {
+            m_Oversized.push_back(i);
+            continue;
+        }
+
+        for (int y = minCell.y; y <= maxCell.y; y++)
+            for (int x = minCell.x; x <= maxCell.x; x++)
+                m_Entries.push_back({ CellKey(x, y), i });
+    }
+
+    // Sort so every cell's colliders are contiguous, then index the runs
+    std::sort(m_Entries.begin(), m_Entries.end(),
+        [](const CellEntry& a, const CellEntry& b) { return a.Key < b.Key || (a.Key == b.Key && a.Index < b.Index); });
+
+    // Table at most half full; assign() reuses the existing allocation when it fits
+    size_t cellCount = 0;
+    for (size_t i = 0; i < m_Entries.size(); i++)
+    {
+        if (i == 0 || m_Entries[i].Key != m_Entries[i - 1].Key)
+            cellCount++;
+    }
+
+    size_t tableSize = 16;
+    while (tableSize < cellCount * 2)
+        tableSize *= 2;
+    m_Cells.assign(tableSize, CellSlot());
+
+    for (uint32_t i = 0; i < (uint32_t)m_Entries.size();)
+    {
+        uint32_t begin = i;
+        uint64_t key = m_Entries[i].Key;
+        while (i < m_Entries.size() && m_Entries[i].Key == key)
+            i++;
+
+        size_t slot = MixKey(key) & (tableSize - 1);
+        while (m_Cells[slot].Range.Count != 0)
+            slot = (slot + 1) & (tableSize - 1);
+
+        m_Cells[slot].Key = key;
+        m_Cells[slot].Range = { begin, i - begin };
+    }
+
+    m_QueryStamp.assign(colliders.size(), 0);
+    m_QueryCounter = 0;
+}
+
+const SpatialHashBroadphase::CellRange* SpatialHashBroadphase::FindCell(uint64_t key) const
+{
+    if (m_Cells.empty()) return nullptr;
+
+    size_t mask = m_Cells.size() - 1;
+    for (size_t slot = MixKey(key) & mask; m_Cells[slot].Range.Count != 0; slot = (slot + 1) & mask)
+    {
+        if (m_Cells[slot].Key == key)
+            return &m_Cells[slot].Range;
+    }
+    return nullptr;
+}
+
+void SpatialHashBroadphase::Query(const AABB& bounds, std::vector<uint32_t>& outIndices) const
+{
+    if (++m_QueryCounter == 0)
+    {
+        // Counter wrapped: clear stamps so old ones can't match
+        std::fill(m_QueryStamp.begin(), m_QueryStamp.end(), 0);
+        m_QueryCounter = 1;
+    }
+
+    glm::ivec2 minCell = ToCell(bounds.Min);
+    glm::ivec2 maxCell = ToCell(bounds.Max);
+
+    // A box covering more cells than there are colliders is cheaper to answer by scanning
+    int64_t cellCount = (int64_t)(maxCell.x - minCell.x + 1) * (int64_t)(maxCell.y - minCell.y + 1);
+    if (cellCount > (int64_t)m_Bounds.size())
+    {
+        for (uint32_t i = 0; i < (uint32_t)m_Bounds.size(); i++)
+        {
+            if (m_Bounds[i].Overlaps(bounds))
+                outIndices.push_back(i);
+        }
+        return;
+    }
+
+    for (int y = minCell.y; y <= maxCell.y; y++)
+    {
+        for (int x = minCell.x; x <= maxCell.x; x++)
+        {
+            const CellRange* range = FindCell(CellKey(x, y));
+            if (!range) continue;
+
+            for (uint32_t e = range->Begin; e < range->Begin + range->Count; e++)
+            {
+                uint32_t index = m_Entries[e].Index;
+                if (m_QueryStamp[index] == m_QueryCounter) continue;
+
+                m_QueryStamp[index] = m_QueryCounter;
+                if (m_Bounds[index].Overlaps(bounds))
+                    outIndices.push_back(index);
+            }
+        }
+    }
+
+    for (uint32_t index : m_Oversized)
+    {
+        if (m_Bounds[index].Overlaps(bounds))
+            outIndices.push_back(index);
+    }
+}
+
+void SpatialHashBroadphase::Raycast(const glm::vec2& start, const glm::vec2& end, RaycastVisitor& visitor) const
+{
+    float maxFraction = 1.0f;
+
+    auto visit = [&](uint32_t index)
+    {
+        float value = visitor.Visit(index, maxFraction);
+        if (value > 0.0f && value < maxFraction) maxFraction = value;
+        return value != 0.0f;
+    };
+
+    // Oversized colliders aren't in the grid
+    for (uint32_t index : m_Oversized)
+    {
+        if (!visit(index)) return;
+    }
+
+    glm::ivec2 cell = ToCell(start);
+    glm::ivec2 endCell = ToCell(end);
+
+    // A ray crossing more cells than there are colliders is cheaper to answer by scanning
+    int64_t cellCount = (int64_t)std::abs(endCell.x - cell.x) + (int64_t)std::abs(endCell.y - cell.y) + 1;
+    if (cellCount > (int64_t)m_Bounds.size())
+    {
+        AABB segmentBounds(glm::min(start, end), glm::max(start, end));
+        for (uint32_t i = 0; i < (uint32_t)m_Bounds.size(); i++)
+        {
+            if (m_Bounds[i].Overlaps(segmentBounds) && !visit(i))
+                return;
+        }
+        return;
+    }
+
+    // Grid DDA: step through the cells in the order the ray enters them. tMax is the
+    // fraction at which the ray crosses into the next cell on each axis.
+    glm::vec2 d = end - start;
+    glm::ivec2 step(d.x > 0.0f ? 1 : -1, d.y > 0.0f ? 1 : -1);
+    glm::vec2 tMax(FLT_MAX);
+    glm::vec2 tDelta(FLT_MAX);
+
+    for (int axis = 0; axis < 2; axis++)
+    {
+        if (d[axis] == 0.0f) continue;
+
+        float boundary = (float)(cell[axis] + (step[axis] > 0 ? 1 : 0)) * m_CellSize;
+        tMax[axis] = (boundary - start[axis]) / d[axis];
+        tDelta[axis] = m_CellSize / std::abs(d[axis]);
+    }
+
+    for (int64_t i = 0; i < cellCount; i++)
+    {
+        if (const CellRange* range = FindCell(CellKey(cell.x, cell.y)))
+        {
+            for (uint32_t e = range->Begin; e < range->Begin + range->Count; e++)
+            {
+                if (!visit(m_Entries[e].Index)) return;
+            }
+        }
+
+        // Every hit past here would be further than the closest one already found
+        int axis = tMax.x < tMax.y ? 0 : 1;
+        if (tMax[axis] > maxFraction) return;
+
+        cell[axis] += step[axis];
+        tMax[axis] += tDelta[axis];
+    }
+}
@@ -0,0 +1,238 @@
+#include "Physics/SweepAndPrune.h"
+#include "Physics/Collider.h"
+
+#include <algorithm>
+
+SweepAndPruneBroadphase::SweepAndPruneBroadphase()
+    : m_MaxWidth(0.0f)
+    , m_PairCount(0)
+    , m_BuildStamp(0)
+{
+}
+
+uint32_t SweepAndPruneBroadphase::AddProxy(Collider* collider)
+{
+    uint32_t proxy;
+    if (!m_FreeProxies.empty())
+    {
+        proxy = m_FreeProxies.back();
+        m_FreeProxies.pop_back();
+    }
+    else
+    {
+        proxy = (uint32_t)m_Proxies.size();
+        m_Proxies.emplace_back();
+    }
+
+    Proxy& p = m_Proxies[proxy];
+    p.Owner = collider;
+    p.Bounds = collider->GetWorldBounds();
+    p.Overlaps.clear();
+    p.Alive = true;
+
+    // New endpoints start past the end of each axis; the sort sweeps them into
+    // place and records every overlap they cross on the way
+    for (int axis = 0; axis < 2; axis++)
+    {
+        p.Endpoints[axis][0] = (uint32_t)m_Endpoints[axis].size();
+        m_Endpoints[axis].push_back({ p.Bounds.Min[axis], proxy, false });
+        p.Endpoints[axis][1] = (uint32_t)m_Endpoints[axis].size();
+        m_Endpoints[axis].push_back({ p.Bounds.Max[axis], proxy, true });
+    }
+
+    m_ProxyOf[collider] = proxy;
+    return proxy;
+}
+
+void SweepAndPruneBroadphase::RemoveProxy(uint32_t proxy)
+{
+    Proxy& p = m_Proxies[proxy];
+
+    while (!p.Overlaps.empty())
+        RemovePair(proxy, p.Overlaps.back());
+
+    // The proxy knows where its endpoints are, so there's nothing to search for
+    for (int axis = 0; axis < 2; axis++)
+    {
+        m_Endpoints[axis][p.Endpoints[axis][0]].Proxy = REMOVED_PROXY;
+        m_Endpoints[axis][p.Endpoints[axis][1]].Proxy = REMOVED_PROXY;
+    }
+
+    m_ProxyOf.erase(p.Owner);
+    p.Owner = nullptr;
+    p.Alive = false;
+    m_FreeProxies.push_back(proxy);
+}
+
+void SweepAndPruneBroadphase::CompactEndpoints()
+{
+    // One pass per axis however many proxies were removed
+    for (int axis = 0; axis < 2; axis++)
+    {
+        std::vector<Endpoint>& endpoints = m_Endpoints[axis];
+
+        uint32_t count = 0;
+        for (const Endpoint& e : endpoints)
+        {
+            if (e.Proxy == REMOVED_PROXY) continue;
+
+            m_Proxies[e.Proxy].Endpoints[axis][e.IsMax] = count;
+            endpoints[count++] = e;
+        }
+
+        endpoints.resize(count);
+    }
+}
+
+void SweepAndPruneBroadphase::AddPair(uint32_t a, uint32_t b)
+{
+    std::vector<uint32_t>& overlaps = m_Proxies[a].Overlaps;
+    if (std::find(overlaps.begin(), overlaps.end(), b) != overlaps.end())
+        return;
+
+    overlaps.push_back(b);
+    m_Proxies[b].Overlaps.push_back(a);
+    m_PairCount++;
+}
+
+void SweepAndPruneBroadphase::RemovePair(uint32_t a, uint32_t b)
+{
+    std::vector<uint32_t>& overlapsA = m_Proxies[a].Overlaps;
+    auto it = std::find(overlapsA.begin(), overlapsA.end(), b);
+    if (it == overlapsA.end())
+        return;
+
+    *it = overlapsA.back();
+    overlapsA.pop_back();
+
+    std::vector<uint32_t>& overlapsB = m_Proxies[b].Overlaps;
+    auto itB = std::find(overlapsB.begin(), overlapsB.end(), a);
+    if (itB != overlapsB.end())
+    {
+        *itB = overlapsB.back();
+        overlapsB.pop_back();
+    }
+
+    m_PairCount--;
+}
+
+void SweepAndPruneBroadphase::SortAxis(int axis)
+{
+    std::vector<Endpoint>& endpoints = m_Endpoints[axis];
+
+    // Insertion sort: each swap is one endpoint crossing another, which is
+    // exactly when an overlap on this axis starts or stops
+    for (size_t i = 1; i < endpoints.size(); i++)
+    {
+        Endpoint key = endpoints[i];
+        size_t j = i;
+
+        while (j > 0 && key < endpoints[j - 1])
+        {
+            const Endpoint& crossed = endpoints[j - 1];
+
+            if (!key.IsMax && crossed.IsMax)
+            {
+                // Our min moved below their max: overlapping on this axis now
+                const Proxy& a = m_Proxies[key.Proxy];
+                const Proxy& b = m_Proxies[crossed.Proxy];
+                if (a.Bounds.Overlaps(b.Bounds))
+                    AddPair(key.Proxy, crossed.Proxy);
+            }
+            else if (key.IsMax && !crossed.IsMax)
+            {
+                // Our max moved below their min: separated on this axis
+                RemovePair(key.Proxy, crossed.Proxy);
+            }
+
+            m_Proxies[crossed.Proxy].Endpoints[axis][crossed.IsMax] = (uint32_t)j;
+            endpoints[j] = crossed;
+            j--;
+        }
+
+        m_Proxies[key.Proxy].Endpoints[axis][key.IsMax] = (uint32_t)j;
+        endpoints[j] = key;
+    }
+}
+
+void SweepAndPruneBroadphase::Build(const std::vector<Collider*>& colliders)
+{
+    m_BuildStamp++;
+    m_ProxyOfIndex.resize(colliders.size());
+    m_MaxWidth = 0.0f;
+
+    // Match colliders to their proxies, creating proxies for new ones
+    for (uint32_t i = 0; i < (uint32_t)colliders.size(); i++)
+    {
+        Collider* collider = colliders[i];
+
+        auto it = m_ProxyOf.find(collider);
+        uint32_t proxy = (it != m_ProxyOf.end()) ? it->second : AddProxy(collider);
+
+        Proxy& p = m_Proxies[proxy];
+        p.Bounds = collider->GetWorldBounds();
+        p.ListIndex = i;
+        p.Stamp = m_BuildStamp;
+        m_ProxyOfIndex[i] = proxy;
+        m_MaxWidth = std::max(m_MaxWidth, p.Bounds.Max.x - p.Bounds.Min.x);
+    }
+
+    // Drop proxies whose collider was unregistered
+    bool removed = false;
+    for (uint32_t proxy = 0; proxy < (uint32_t)m_Proxies.size(); proxy++)
+    {
+        if (m_Proxies[proxy].Alive && m_Proxies[proxy].Stamp != m_BuildStamp)
+        {
+            RemoveProxy(proxy);
+            removed = true;
+        }
+    }
+
+    if (removed)
+        CompactEndpoints();
+
+    // Refresh endpoint values, then restore order (cheap when little moved)
+    for (int axis = 0; axis < 2; axis++)
+    {
+        for (Endpoint& e : m_Endpoints[axis])
+        {
+            const AABB& bounds = m_Proxies[e.Proxy].Bounds;
+            e.Value = e.IsMax ? bounds.Max[axis] : bounds.Min[axis];
+        }
+
+        SortAxis(axis);
+    }
+}
+
+void SweepAndPruneBroadphase::Query(const AABB& bounds, std::vector<uint32_t>& outIndices) const
+{
+    // No proxy is wider than m_MaxWidth, so any that reaches the query starts at or
+    // after Min.x - m_MaxWidth: binary search to there and walk to the query's end
+    const std::vector<Endpoint>& endpoints = m_Endpoints[0];
+    auto first = std::lower_bound(endpoints.begin(), endpoints.end(), bounds.Min.x - m_MaxWidth,
+        [](const Endpoint& e, float value) { return e.Value < value; });
+
+    for (auto it = first; it != endpoints.end(); ++it)
+    {
+        const Endpoint& e = *it;
+        if (e.Value > bounds.Max.x) break;
+        if (e.IsMax) continue;
+
+        const Proxy& p = m_Proxies[e.Proxy];
+        if (p.Bounds.Overlaps(bounds))
+            outIndices.push_back(p.ListIndex);
+    }
+}
+
+void SweepAndPruneBroadphase::QueryCollider(uint32_t index, const AABB& bounds, std::vector<uint32_t>& outIndices) const
+{
+    if (index >= m_ProxyOfIndex.size())
+    {
+        Query(bounds, outIndices);
+        return;
+    }
+
+    // Registered colliders already know who they overlap
+    for (uint32_t other : m_Proxies[m_ProxyOfIndex[index]].Overlaps)
+        outIndices.push_back(m_Proxies[other].ListIndex);
+}
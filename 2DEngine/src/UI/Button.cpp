@@ -78,16 +78,20 @@ void Button::Render()
     if (!m_Text.empty())
     {
         float textScale = 1.5f;  // Increased scale for better readability
-        float textWidth = TextRenderer::GetTextWidth(m_Text, textScale);
-        float textHeight = 7.0f * 2.0f * textScale;  // Character height
+        glm::vec4 textColor = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+
+        // Laid out once, centered on the origin; only re-fetched when the text or the
+        // active font changes, or the font evicted a glyph page it used
+        if (!m_TextMesh || m_TextMesh->Layout->LayoutFont != TextRenderer::GetActiveFont() ||
+            !TextCache::IsCurrent(*m_TextMesh))
+            m_TextMesh = TextCache::Get(m_Text, TextLayoutParams(textScale, TextAlign::Center), textColor);
+        if (!m_TextMesh) return;
 
-        // Center text on button
+        // Center the glyph bounds on the button
         glm::vec2 textPos = m_Position;
-        textPos.x -= textWidth / 2.0f;
-        textPos.y += textHeight / 4.0f;  // Adjust for better vertical centering
+        textPos.y -= m_TextMesh->Layout->GetCenter().y;
 
-        glm::vec4 textColor = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
-        TextRenderer::RenderText(m_Text, textPos, textScale, textColor);
+        TextRenderer::RenderText(*m_TextMesh, textPos);
     }
 }
 
@@ -0,0 +1,29 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec2 v_Local;
+in vec4 v_Color;
+flat in vec2 v_Shape;  // x: 0 = solid, 1 = circle, 2 = text; y: circle inner radius (outer = 1)
+
+uniform sampler2D u_FontAtlas;  // Built-in bitmap font, rows top-down
+
+void main()
+{
+    float alpha = 1.0;
+
+    if (v_Shape.x > 1.5)
+    {
+        // Text: v_Local is the atlas texel
+        alpha = texelFetch(u_FontAtlas, ivec2(v_Local), 0).r;
+    }
+    else if (v_Shape.x > 0.5)
+    {
+        // Circle: v_Local runs over the unit square around it, edges one pixel soft
+        float d = length(v_Local);
+        float aa = max(fwidth(d), 1e-4);
+        alpha = (1.0 - smoothstep(1.0 - aa, 1.0, d)) * smoothstep(v_Shape.y - aa, v_Shape.y, d);
+    }
+
+    if (alpha <= 0.0) discard;
+    FragColor = vec4(v_Color.rgb, v_Color.a * alpha);
+}
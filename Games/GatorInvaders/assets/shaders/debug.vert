@@ -0,0 +1,21 @@
+#version 330 core
+
+layout (location = 0) in vec2 a_Position;
+layout (location = 1) in vec2 a_Local;
+layout (location = 2) in vec4 a_Color;
+layout (location = 3) in vec2 a_Shape;
+
+uniform mat4 u_ViewProjection;
+
+out vec2 v_Local;
+out vec4 v_Color;
+flat out vec2 v_Shape;
+
+void main()
+{
+    v_Local = a_Local;
+    v_Color = a_Color;
+    v_Shape = a_Shape;
+
+    gl_Position = u_ViewProjection * vec4(a_Position, 0.0, 1.0);
+}
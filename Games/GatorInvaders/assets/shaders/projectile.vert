@@ -0,0 +1,22 @@
+#version 330 core
+
+layout (location = 0) in vec2 a_Corner;     // Unit quad, -0.5..0.5
+
+// Per projectile (ProjectileSystem's packed arrays)
+layout (location = 1) in float a_PositionX;
+layout (location = 2) in float a_PositionY;
+layout (location = 3) in float a_SizeX;
+layout (location = 4) in float a_SizeY;
+layout (location = 5) in vec4 a_Color;
+
+uniform mat4 u_ViewProjection;
+
+out vec4 v_Color;
+
+void main()
+{
+    v_Color = a_Color;
+
+    vec2 position = vec2(a_PositionX, a_PositionY) + a_Corner * vec2(a_SizeX, a_SizeY);
+    gl_Position = u_ViewProjection * vec4(position, 0.0, 1.0);
+}
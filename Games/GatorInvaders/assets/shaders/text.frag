@@ -0,0 +1,120 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec2 v_TexCoord;
+flat in vec4 v_GlyphRect;
+
+uniform sampler2D u_FontAtlas;
+uniform vec4 u_Color;
+
+uniform float u_TexelSize;     // World units per atlas texel
+uniform float u_OutlineWidth;  // World units
+uniform vec4 u_OutlineColor;
+uniform vec2 u_ShadowOffset;   // World units
+uniform vec4 u_ShadowColor;
+
+uniform int u_IsSDF;            // 1 = signed distance field atlas, 0 = bitmap coverage
+uniform float u_DistanceScale;  // SDF: texels of distance per unit of atlas value
+
+// Glyph coverage at an atlas texel position (zero outside this glyph's cell)
+float Coverage(vec2 t)
+{
+    if (t.x < v_GlyphRect.x || t.y < v_GlyphRect.y ||
+        t.x >= v_GlyphRect.z || t.y >= v_GlyphRect.w)
+        return 0.0;
+
+    return texelFetch(u_FontAtlas, ivec2(t), 0).r;
+}
+
+// SDF: signed distance to the glyph edge in texels (positive inside)
+float Distance(vec2 t)
+{
+    if (t.x < v_GlyphRect.x || t.y < v_GlyphRect.y ||
+        t.x >= v_GlyphRect.z || t.y >= v_GlyphRect.w)
+        return -1e3;
+
+    float v = texture(u_FontAtlas, t / vec2(textureSize(u_FontAtlas, 0))).r;
+    return (v - 0.5) * u_DistanceScale;
+}
+
+// SDF: anti-aliased coverage of the glyph grown by 'grow' texels
+float SdfCoverage(vec2 t, float grow, float aa)
+{
+    return smoothstep(-aa, aa, Distance(t) + grow);
+}
+
+// Porter-Duff "over" for straight (non-premultiplied) alpha
+vec4 Over(vec4 top, vec4 bottom)
+{
+    float a = top.a + bottom.a * (1.0 - top.a);
+    if (a <= 0.0) return vec4(0.0);
+    vec3 rgb = (top.rgb * top.a + bottom.rgb * bottom.a * (1.0 - top.a)) / a;
+    return vec4(rgb, a);
+}
+
+void SdfMain()
+{
+    // Screen-space width of one texel keeps edges one pixel soft at any scale
+    float aa = max(length(fwidth(v_TexCoord)) * 0.5, 1e-4);
+
+    vec4 col = vec4(u_Color.rgb, u_Color.a * SdfCoverage(v_TexCoord, 0.0, aa));
+
+    // Outline: the same field with the edge pushed outwards
+    if (u_OutlineWidth > 0.0)
+    {
+        float outline = SdfCoverage(v_TexCoord, u_OutlineWidth / u_TexelSize, aa);
+        col = Over(col, vec4(u_OutlineColor.rgb, u_OutlineColor.a * outline));
+    }
+
+    if (u_ShadowOffset != vec2(0.0))
+    {
+        vec2 shift = vec2(u_ShadowOffset.x, -u_ShadowOffset.y) / u_TexelSize;
+        float shadow = SdfCoverage(v_TexCoord - shift, 0.0, aa);
+        col = Over(col, vec4(u_ShadowColor.rgb, u_ShadowColor.a * shadow));
+    }
+
+    if (col.a <= 0.0) discard;
+    FragColor = col;
+}
+
+void main()
+{
+    if (u_IsSDF == 1)
+    {
+        SdfMain();
+        return;
+    }
+
+    vec4 col = vec4(u_Color.rgb, u_Color.a * Coverage(v_TexCoord));
+
+    // Outline: dilate the glyph by sampling its neighbourhood
+    if (u_OutlineWidth > 0.0)
+    {
+        float r = u_OutlineWidth / u_TexelSize;
+        float d = r * 0.70710678;
+
+        float outline = 0.0;
+        outline = max(outline, Coverage(v_TexCoord + vec2( r,  0.0)));
+        outline = max(outline, Coverage(v_TexCoord + vec2(-r,  0.0)));
+        outline = max(outline, Coverage(v_TexCoord + vec2(0.0,  r)));
+        outline = max(outline, Coverage(v_TexCoord + vec2(0.0, -r)));
+        outline = max(outline, Coverage(v_TexCoord + vec2( d,  d)));
+        outline = max(outline, Coverage(v_TexCoord + vec2(-d,  d)));
+        outline = max(outline, Coverage(v_TexCoord + vec2( d, -d)));
+        outline = max(outline, Coverage(v_TexCoord + vec2(-d, -d)));
+
+        col = Over(col, vec4(u_OutlineColor.rgb, u_OutlineColor.a * outline));
+    }
+
+    // Drop shadow: the glyph shifted by the shadow offset, drawn underneath
+    if (u_ShadowOffset != vec2(0.0))
+    {
+        vec2 shift = vec2(u_ShadowOffset.x, -u_ShadowOffset.y) / u_TexelSize;
+        float shadow = Coverage(v_TexCoord - shift);
+
+        col = Over(col, vec4(u_ShadowColor.rgb, u_ShadowColor.a * shadow));
+    }
+
+    if (col.a <= 0.0) discard;
+    FragColor = col;
+}
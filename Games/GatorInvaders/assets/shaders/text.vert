@@ -0,0 +1,25 @@
+#version 330 core
+
+layout (location = 0) in vec2 a_Position;
+layout (location = 1) in vec2 a_TexCoord;
+layout (location = 2) in vec4 a_GlyphRect;
+layout (location = 3) in vec2 a_Corner;
+
+uniform mat4 u_ViewProjection;
+uniform vec2 u_Offset;
+
+uniform float u_Margin;     // World units each quad grows by (outline + shadow)
+uniform float u_TexelSize;  // World units per atlas texel
+
+out vec2 v_TexCoord;
+flat out vec4 v_GlyphRect;
+
+void main()
+{
+    // Atlas rows run top-down while world Y runs up
+    vec2 grow = a_Corner * u_Margin;
+    v_TexCoord = a_TexCoord + vec2(grow.x, -grow.y) / u_TexelSize;
+    v_GlyphRect = a_GlyphRect;
+
+    gl_Position = u_ViewProjection * vec4(a_Position + grow + u_Offset, 0.0, 1.0);
+}
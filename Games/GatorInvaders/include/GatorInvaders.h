@@ -2,6 +2,7 @@
 
 #include "Core/Game.h"
 #include "Audio/AudioManager.h"
+#include "Entities/ProjectileSystem.h"
 #include <memory>
 #include <string>
 #include <vector>
@@ -12,7 +13,6 @@
 // Forward declarations
 class Player;
 class Enemy;
-class Bullet;
 class Obstacle;
 class Entity;
 class Menu;
@@ -42,6 +42,7 @@ public:
     void OnInit() override;
     void OnShutdown() override;
     void OnUpdate(float deltaTime) override;
+    void OnFixedUpdate(float fixedDeltaTime) override;
     void OnRender() override;
     void OnInput(float deltaTime) override;
 
@@ -52,7 +53,7 @@ private:
     void ShootBullet();
     void EnemyShoot();
     void CheckCollisions();
-    void CleanupDeadEntities();
+    void DrawDebugOverlay();
     void NextLevel();
     void RestartGame();
     void GameOver();
@@ -109,8 +110,7 @@ private:
     int m_CurrentEnemyFrame;  // For animation (0 or 1)
 
     // Bullets
-    std::unique_ptr<Bullet> m_PlayerBullet;
-    std::vector<std::unique_ptr<Bullet>> m_EnemyBullets;
+    ProjectileHandle m_PlayerShot;  // At most one player shot in flight; enemy shots aren't tracked
     float m_EnemyShootTimer;
     float m_EnemyShootInterval;
     float m_PlayerShootCooldown;
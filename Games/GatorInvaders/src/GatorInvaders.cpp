@@ -9,7 +9,6 @@
 #include "Entities/Entity.h"
 #include "Entities/Player.h"
 #include "Entities/Enemy.h"
-#include "Entities/Bullet.h"
 #include "Entities/Obstacle.h"
 
 #include "Core/Window.h"
@@ -18,6 +17,7 @@
 #include "Graphics/Renderer.h"
 #include "Graphics/TextRenderer.h"
 #include "Graphics/Camera.h"
+#include "Graphics/DebugDraw.h"
 #include "Graphics/Texture.h"
 
 #include "Input/Input.h"
@@ -30,6 +30,7 @@
 #include <GLFW/glfw3.h>
 
 #include <algorithm>
+#include <cfloat>
 #include <cmath>
 #include <cstdlib>
 #include <iostream>
@@ -37,9 +38,38 @@
 #include <string>
 #include <vector>
 
+// ------------------------------------------------------------
+// Collision layers (collider category bits)
+// ------------------------------------------------------------
+enum CollisionLayer : uint32_t
+{
+    LAYER_PLAYER        = 1 << 0,
+    LAYER_ENEMY         = 1 << 1,
+    LAYER_UFO           = 1 << 2,
+    LAYER_PLAYER_BULLET = 1 << 3,
+    LAYER_ENEMY_BULLET  = 1 << 4,
+    LAYER_BARRIER       = 1 << 5,
+    LAYER_WALL          = 1 << 6
+};
+
+// What each layer's colliders are allowed to touch
+static constexpr uint32_t PLAYER_MASK        = LAYER_ENEMY_BULLET;
+static constexpr uint32_t ENEMY_MASK         = LAYER_PLAYER_BULLET;
+static constexpr uint32_t UFO_MASK           = LAYER_PLAYER_BULLET;
+static constexpr uint32_t PLAYER_BULLET_MASK = LAYER_ENEMY | LAYER_UFO | LAYER_BARRIER | LAYER_WALL;
+static constexpr uint32_t ENEMY_BULLET_MASK  = LAYER_PLAYER | LAYER_BARRIER;
+static constexpr uint32_t BARRIER_MASK       = LAYER_PLAYER_BULLET | LAYER_ENEMY_BULLET;
+static constexpr uint32_t WALL_MASK          = LAYER_PLAYER_BULLET;
+
 // ------------------------------------------------------------
 // Small helpers (file-local)
 // ------------------------------------------------------------
+static void SetLayers(Collider* collider, uint32_t category, uint32_t mask)
+{
+    collider->SetCategory(category);
+    collider->SetMask(mask);
+}
+
 static float Clamp01(float v) { return std::max(0.0f, std::min(1.0f, v)); }
 
 static glm::vec4 GetBarrierPartUV(int partIndex, int parts, Texture* tex)
@@ -63,6 +93,10 @@ static glm::vec4 GetBarrierPartUV(int partIndex, int parts, Texture* tex)
 
 static constexpr float UFO_RENDER_OFFSET_X = -7.0f; // +right / -left
 
+// Formation turns around once an enemy passes this x, and wins once one drops below INVASION_Y
+static constexpr float FORMATION_EDGE_X = 500.0f;
+static constexpr float INVASION_Y = -200.0f;
+
 
 // ------------------------------------------------------------
 
@@ -135,6 +169,8 @@ void GatorInvaders::OnInit()
     );
     m_CeilingWall->SetName("CeilingWall");
     m_CeilingWall->SetColor(glm::vec4(0, 0, 0, 0)); // invisible
+    SetLayers(m_CeilingWall->GetCollider(), LAYER_WALL, WALL_MASK);
+    m_CeilingWall->GetCollider()->SetStatic(true);
 
     SetupMainMenu();
     SetupPauseMenu();
@@ -156,8 +192,7 @@ void GatorInvaders::OnShutdown()
 
     m_Enemies.clear();
     m_EnemyRowScores.clear();
-    m_EnemyBullets.clear();
-    m_PlayerBullet.reset();
+    ProjectileSystem::Clear();
     m_Player.reset();
     m_CeilingWall.reset();
 
@@ -442,8 +477,7 @@ void GatorInvaders::ShowMainMenu()
     // cleanup gameplay objects
     m_Enemies.clear();
     m_EnemyRowScores.clear();
-    m_EnemyBullets.clear();
-    m_PlayerBullet.reset();
+    ProjectileSystem::Clear();
     m_Player.reset();
 
     // Clear barrier segments
@@ -503,6 +537,7 @@ void GatorInvaders::StartGame()
 
     auto playerCollider = std::make_unique<BoxCollider>(m_Player.get(), m_Player->GetSize());
     playerCollider->SetTrigger(true);
+    SetLayers(playerCollider.get(), LAYER_PLAYER, PLAYER_MASK);
     m_Player->SetCollider(std::move(playerCollider));
 
     SpawnEnemyGrid();
@@ -638,11 +673,10 @@ void GatorInvaders::SpawnEnemyGrid()
             enemy->SetTexture(sheet);
             enemy->SetAnimationFrame(0);
 
-            const float ENEMY_HITBOX_SCALE = 0.75f; // same for all enemies
-            glm::vec2 colliderSize = enemySize * ENEMY_HITBOX_SCALE;
-
-            auto collider = std::make_unique<BoxCollider>(enemy.get(), colliderSize);
+            // Pixel-perfect hits against the sprite; SetAnimationFrame keeps it on the drawn frame
+            auto collider = std::make_unique<MaskCollider>(enemy.get(), enemySize, sheet->GetPath(), 2);
             collider->SetTrigger(true);
+            SetLayers(collider.get(), LAYER_ENEMY, ENEMY_MASK);
             enemy->SetCollider(std::move(collider));
 
 
@@ -724,6 +758,8 @@ void GatorInvaders::SpawnBarriers()
                 // Trigger: we handle bullet kill manually
                 auto collider = std::make_unique<BoxCollider>(part.obstacle.get(), glm::vec2(partW, partH));
                 collider->SetTrigger(true);
+                SetLayers(collider.get(), LAYER_BARRIER, BARRIER_MASK);
+                collider->SetStatic(true);  // Barriers never move
                 part.obstacle->SetCollider(std::move(collider));
 
                 // Map collider owner -> indices
@@ -743,22 +779,20 @@ void GatorInvaders::ShootBullet()
 {
     if (!m_Player) return;
 
-    if (m_PlayerBullet && m_PlayerBullet->IsAlive())
+    if (ProjectileSystem::IsAlive(m_PlayerShot))
         return;
 
     AudioManager::PlaySFX("shoot");
 
-    glm::vec2 bulletPos = m_Player->GetPosition();
-    bulletPos.y += 20.0f;
+    ProjectileDesc shot;
+    shot.Position = m_Player->GetPosition() + glm::vec2(0.0f, 20.0f);
+    shot.Velocity = glm::vec2(0.0f, 600.0f);
+    shot.Size = glm::vec2(4.0f, 15.0f);
+    shot.Color = glm::vec4(1, 1, 1, 1);
+    shot.Category = LAYER_PLAYER_BULLET;
+    shot.Mask = PLAYER_BULLET_MASK;
 
-    m_PlayerBullet = std::make_unique<Bullet>(bulletPos, glm::vec2(0.0f, 1.0f), 600.0f);
-    m_PlayerBullet->SetName("PlayerBullet");
-    m_PlayerBullet->SetSize(glm::vec2(4.0f, 15.0f));
-    m_PlayerBullet->SetColor(glm::vec4(1, 1, 1, 1));
-
-    auto collider = std::make_unique<BoxCollider>(m_PlayerBullet.get(), glm::vec2(4.0f, 15.0f));
-    collider->SetTrigger(true);
-    m_PlayerBullet->SetCollider(std::move(collider));
+    m_PlayerShot = ProjectileSystem::Spawn(shot);
 }
 
 void GatorInvaders::EnemyShoot()
@@ -781,23 +815,26 @@ void GatorInvaders::EnemyShoot()
 
     if (!shooter) return;
 
-    auto bullet = std::make_unique<Bullet>(
-        shooter->GetPosition(),
-        glm::vec2(0.0f, -1.0f),
-        300.0f
-    );
-    bullet->SetName("EnemyBullet");
-    bullet->SetSize(glm::vec2(4.0f, 12.0f));
-    bullet->SetColor(glm::vec4(1, 0, 0, 1));
+    ProjectileDesc shot;
+    shot.Position = shooter->GetPosition();
+    shot.Velocity = glm::vec2(0.0f, -300.0f);
+    shot.Size = glm::vec2(4.0f, 12.0f);
+    shot.Color = glm::vec4(1, 0, 0, 1);
+    shot.Category = LAYER_ENEMY_BULLET;
+    shot.Mask = ENEMY_BULLET_MASK;
 
-    auto collider = std::make_unique<BoxCollider>(bullet.get(), glm::vec2(4.0f, 12.0f));
-    collider->SetTrigger(true);
-    bullet->SetCollider(std::move(collider));
-
-    m_EnemyBullets.push_back(std::move(bullet));
+    ProjectileSystem::Spawn(shot);
     AudioManager::PlaySFX("shoot");
 }
 
+void GatorInvaders::OnFixedUpdate(float /*fixedDeltaTime*/)
+{
+    // Physics keeps stepping in every state, but the player is only steered while
+    // playing; hold it still elsewhere so it doesn't coast through pauses and freezes
+    if (m_State != GameState::Playing && m_Player)
+        m_Player->Stop();
+}
+
 void GatorInvaders::OnUpdate(float deltaTime)
 {
     // Menus / frozen states
@@ -867,17 +904,8 @@ void GatorInvaders::OnUpdate(float deltaTime)
         m_Player->SetPosition(p);
     }
 
-    // Player bullet update
-    if (m_PlayerBullet)
-    {
-        m_PlayerBullet->Update(deltaTime);
-        if (!m_PlayerBullet->IsAlive())
-            m_PlayerBullet.reset();
-    }
-
-    // Enemy bullets update
-    for (auto& b : m_EnemyBullets)
-        b->Update(deltaTime);
+    // Player and enemy shots
+    ProjectileSystem::Update(deltaTime);
 
     // UFO update/spawn
     if (m_UFOActive && m_UFO)
@@ -923,9 +951,9 @@ void GatorInvaders::OnUpdate(float deltaTime)
 
 
 
-            glm::vec2 ufoColliderSize = size * 0.55f;
-            auto col = std::make_unique<BoxCollider>(m_UFO.get(), ufoColliderSize);
+            auto col = std::make_unique<MaskCollider>(m_UFO.get(), size, m_UFOTexture->GetPath());
             col->SetTrigger(true);
+            SetLayers(col.get(), LAYER_UFO, UFO_MASK);
             m_UFO->SetCollider(std::move(col));
 
 
@@ -949,8 +977,8 @@ void GatorInvaders::OnUpdate(float deltaTime)
         {
             if (!e->IsAlive()) continue;
             float x = e->GetPosition().x;
-            if ((m_EnemyDirection > 0 && x > 500.0f) ||
-                (m_EnemyDirection < 0 && x < -500.0f))
+            if ((m_EnemyDirection > 0 && x > FORMATION_EDGE_X) ||
+                (m_EnemyDirection < 0 && x < -FORMATION_EDGE_X))
             {
                 hitEdge = true;
                 break;
@@ -967,7 +995,7 @@ void GatorInvaders::OnUpdate(float deltaTime)
             if (hitEdge)
             {
                 pos.y -= 20.0f;
-                if (pos.y < -200.0f)
+                if (pos.y < INVASION_Y)
                 {
                     GameOver();
                     return;
@@ -999,16 +1027,6 @@ void GatorInvaders::OnUpdate(float deltaTime)
     }
 
     CheckCollisions();
-    CleanupDeadEntities();
-}
-
-void GatorInvaders::CleanupDeadEntities()
-{
-    m_EnemyBullets.erase(
-        std::remove_if(m_EnemyBullets.begin(), m_EnemyBullets.end(),
-            [](const std::unique_ptr<Bullet>& b) { return !b->IsAlive(); }),
-        m_EnemyBullets.end()
-    );
 }
 
 void GatorInvaders::CheckCollisions()
@@ -1031,6 +1049,10 @@ void GatorInvaders::CheckCollisions()
         if (part.stage >= BARRIER_STAGES)
         {
             part.broken = true;
+
+            // Broken pieces must not stop sweeps short of what's behind them
+            if (auto* c = ent->GetCollider())
+                c->SetEnabled(false);
             // On the hit that breaks it, we still consume
             return true;
         }
@@ -1038,182 +1060,90 @@ void GatorInvaders::CheckCollisions()
         return true; // consumed (bullet dies) if it hit an unbroken piece
     };
 
-    auto SegmentIntersectsAABB = [](glm::vec2 p0, glm::vec2 p1, glm::vec2 minB, glm::vec2 maxB) -> bool
-    {
-        // Liang–Barsky style parametric clip
-        glm::vec2 d = p1 - p0;
-        float tmin = 0.0f, tmax = 1.0f;
-
-        auto clip = [&](float p, float q) {
-            if (p == 0.0f) return q >= 0.0f;
-            float r = q / p;
-            if (p < 0.0f) { if (r > tmax) return false; if (r > tmin) tmin = r; }
-            else         { if (r < tmin) return false; if (r < tmax) tmax = r; }
-            return true;
-        };
-
-        if (!clip(-d.x, p0.x - minB.x)) return false;
-        if (!clip( d.x, maxB.x - p0.x)) return false;
-        if (!clip(-d.y, p0.y - minB.y)) return false;
-        if (!clip( d.y, maxB.y - p0.y)) return false;
-        return true;
-    };
-
-    if (m_PlayerBullet && m_PlayerBullet->IsAlive())
-    {
-        glm::vec2 p0 = m_PlayerBullet->GetPrevPosition();
-        glm::vec2 p1 = m_PlayerBullet->GetPosition();
-
-        for (size_t i = 0; i < m_Enemies.size(); i++)
-        {
-            auto& e = m_Enemies[i];
-            if (!e || !e->IsAlive()) continue;
-
-            auto* col = e->GetCollider();
-            auto* box = dynamic_cast<BoxCollider*>(col);
-            if (!box) continue;
-
-            // BoxCollider stores its size (you call SetSize on it in Bullet, so it exists here too)
-            glm::vec2 half = box->GetSize() * 0.5f;   // <-- if BoxCollider has GetSize()
-
-            glm::vec2 c = e->GetPosition();
-            glm::vec2 minB = c - half;
-            glm::vec2 maxB = c + half;
-
-
-            if (SegmentIntersectsAABB(p0, p1, minB, maxB))
-            {
-                e->Kill();
-                if (auto* c = e->GetCollider())
-                    c->SetEnabled(false);
-
-                m_PlayerBullet->Kill();
-                AudioManager::PlaySFX("enemy_killed");
-                int points = (i < m_EnemyRowScores.size()) ? m_EnemyRowScores[i] : 10;
-                m_Score += points;
-                return; // bullet consumed
-            }
-        }
-    }
-
-
     // ----------------------------
-    // Player bullet collisions
+    // Shots: each one's path this frame is swept, so fast shots can't skip over
+    // anything; the first collider it touches decides what happens. Returning true
+    // despawns the shot.
     // ----------------------------
-    if (m_PlayerBullet && m_PlayerBullet->IsAlive() && m_PlayerBullet->GetCollider())
+    ProjectileSystem::Collide([&](ProjectileHandle shot, const RaycastHit& hit) -> bool
     {
-        auto hits = Physics::GetCollisions(m_PlayerBullet->GetCollider());
+        Entity* ent = hit.HitCollider->GetOwner();
+        uint32_t layer = hit.HitCollider->GetCategory();
 
-        for (auto* hitCol : hits)
-        {
-            Entity* ent = hitCol->GetOwner();
-            if (!ent) continue;
+        // Barrier part: advance stage on hit (either side's shots)
+        if (layer & LAYER_BARRIER)
+            return hitBarrierPart(ent);
 
+        if (shot == m_PlayerShot)
+        {
             // Ceiling: despawn bullet
-            if (ent->GetName() == "CeilingWall")
-            {
-                m_PlayerBullet->Kill();
-                break;
-            }
-
-            // Barrier part: advance stage on hit
-            if (ent->GetName() == "BarrierPart")
-            {
-                if (hitBarrierPart(ent))
-                    m_PlayerBullet->Kill();
-
-                break;
-            }
+            if (layer & LAYER_WALL)
+                return true;
 
             // Enemy: kill enemy, add score, despawn bullet
-            if (ent->GetName() == "Enemy")
+            if (layer & LAYER_ENEMY)
             {
                 for (size_t i = 0; i < m_Enemies.size(); i++)
                 {
                     if ((Entity*)m_Enemies[i].get() != ent) continue;
-                    if (!m_Enemies[i]->IsAlive()) break;
+                    if (!m_Enemies[i]->IsAlive()) return false;
 
                     m_Enemies[i]->Kill();
                     if (auto* c = m_Enemies[i]->GetCollider())
                         c->SetEnabled(false);
 
-                    m_PlayerBullet->Kill();
-
                     AudioManager::PlaySFX("enemy_killed");
 
                     int points = (i < m_EnemyRowScores.size()) ? m_EnemyRowScores[i] : 10;
                     m_Score += points;
-                    break;
+                    return true;
                 }
-                break;
+                return false;
             }
 
             // UFO: bonus
-            if (ent->GetName() == "UFO")
+            if (layer & LAYER_UFO)
             {
-                if (m_UFOActive && m_UFO && (Entity*)m_UFO.get() == ent && m_UFO->IsAlive())
-                {
-                    m_UFO->Kill();
-                    m_PlayerBullet->Kill();
-                    m_UFOActive = false;
+                if (!m_UFOActive || !m_UFO || (Entity*)m_UFO.get() != ent || !m_UFO->IsAlive())
+                    return false;
 
-                    AudioManager::StopSFX("ufo");
-                    AudioManager::PlaySFX("ufo_killed");
+                m_UFO->Kill();
+                m_UFOActive = false;
 
-                    static const int ufoScores[] = { 50, 100, 150, 300 };
-                    int bonus = ufoScores[rand() % 4];
-                    m_Score += bonus;
+                AudioManager::StopSFX("ufo");
+                AudioManager::PlaySFX("ufo_killed");
 
-                    m_UFO.reset();
-                }
-                break;
-            }
-        }
-    }
+                static const int ufoScores[] = { 50, 100, 150, 300 };
+                int bonus = ufoScores[rand() % 4];
+                m_Score += bonus;
 
-    // ----------------------------
-    // Enemy bullets vs barriers & player
-    // ----------------------------
-    for (auto& bullet : m_EnemyBullets)
-    {
-        if (!bullet->IsAlive() || !bullet->GetCollider()) continue;
+                m_UFO.reset();
+                return true;
+            }
 
-        auto hits = Physics::GetCollisions(bullet->GetCollider());
+            return false;
+        }
 
-        for (auto* hitCol : hits)
+        // Enemy bullet hits player
+        if ((layer & LAYER_PLAYER) && m_Player && ent == m_Player.get())
         {
-            Entity* ent = hitCol->GetOwner();
-            if (!ent) continue;
+            m_Lives--;
+            AudioManager::PlaySFX("player_hit");
 
-            // Barrier part
-            if (ent->GetName() == "BarrierPart")
+            if (m_Lives <= 0)
             {
-                if (hitBarrierPart(ent))
-                    bullet->Kill();
-
-                break;
+                GameOver();
             }
-
-            // Enemy bullet hits player
-            if (m_Player && ent == m_Player.get())
+            else
             {
-                bullet->Kill();
-                m_Lives--;
-                AudioManager::PlaySFX("player_hit");
-
-                if (m_Lives <= 0)
-                {
-                    GameOver();
-                }
-                else
-                {
-                    m_State = GameState::PlayerHit;
-                    m_PlayerHitTimer = 0.0f;
-                }
-                break;
+                m_State = GameState::PlayerHit;
+                m_PlayerHitTimer = 0.0f;
             }
+            return true;
         }
-    }
+
+        return false;
+    });
 }
 
 void GatorInvaders::OnRender()
@@ -1234,41 +1164,32 @@ void GatorInvaders::OnRender()
     {
         glm::vec2 camPos = GetCamera()->GetPosition();
 
-        glm::vec2 titlePos = glm::vec2(camPos.x - 280.0f, camPos.y + 220.0f);
-        float titleScale = 3.5f;
-
-        // --- White outline (4 directions) ---
-        glm::vec4 outlineColor(1, 1, 1, 1);
-        float o = 2.0f;
+        // Centered on the camera by the text layout rather than hand-tuned offsets
+        glm::vec2 titlePos = glm::vec2(camPos.x, camPos.y + 220.0f);
+        TextLayoutParams titleLayout(3.5f, TextAlign::Center);
 
-        TextRenderer::RenderText("GATOR INVADERS", titlePos + glm::vec2(-o,  0), titleScale, outlineColor);
-        TextRenderer::RenderText("GATOR INVADERS", titlePos + glm::vec2( o,  0), titleScale, outlineColor);
-        TextRenderer::RenderText("GATOR INVADERS", titlePos + glm::vec2( 0, -o), titleScale, outlineColor);
-        TextRenderer::RenderText("GATOR INVADERS", titlePos + glm::vec2( 0,  o), titleScale, outlineColor);
+        // White outline, drawn by the text shader in the same pass
+        TextEffects outline;
+        outline.OutlineWidth = 2.0f;
+        outline.OutlineColor = glm::vec4(1, 1, 1, 1);
 
-        // --- Main text ---
         TextRenderer::RenderText(
             "GATOR INVADERS",
             titlePos,
-            titleScale,
-            glm::vec4(1.0f, 0.7f, 0.0f, 1.0f) // bright UF orange
+            titleLayout,
+            glm::vec4(1.0f, 0.7f, 0.0f, 1.0f), // bright UF orange
+            outline
         );
 
-        glm::vec2 subPos = glm::vec2(camPos.x - 190.0f, camPos.y + 160.0f);
-        float subScale = 1.5f;
+        glm::vec2 subPos = glm::vec2(camPos.x, camPos.y + 160.0f);
+        TextLayoutParams subLayout(1.5f, TextAlign::Center);
 
-        // Outline
-        TextRenderer::RenderText("University of Florida", subPos + glm::vec2(-o,  0), subScale, outlineColor);
-        TextRenderer::RenderText("University of Florida", subPos + glm::vec2( o,  0), subScale, outlineColor);
-        TextRenderer::RenderText("University of Florida", subPos + glm::vec2( 0, -o), subScale, outlineColor);
-        TextRenderer::RenderText("University of Florida", subPos + glm::vec2( 0,  o), subScale, outlineColor);
-
-        // Main text
         TextRenderer::RenderText(
             "University of Florida",
             subPos,
-            subScale,
-            glm::vec4(0.1f, 0.5f, 1.0f, 1.0f) // bright blue
+            subLayout,
+            glm::vec4(0.1f, 0.5f, 1.0f, 1.0f), // bright blue
+            outline
         );
 
 
@@ -1284,8 +1205,8 @@ void GatorInvaders::OnRender()
         glm::vec2 camPos = GetCamera()->GetPosition();
 
         TextRenderer::RenderText("CONTROLS",
-            glm::vec2(camPos.x - 140.0f, camPos.y + 260.0f),
-            3.0f,
+            glm::vec2(camPos.x, camPos.y + 260.0f),
+            TextLayoutParams(3.0f, TextAlign::Center),
             glm::vec4(1, 1, 1, 1));
 
         float x  = camPos.x - 420.0f;
@@ -1302,8 +1223,8 @@ void GatorInvaders::OnRender()
         TextRenderer::RenderText("       Show Hitboxes:       F1",             glm::vec2(x, y), s, glm::vec4(1,1,1,1)); y -= dy;
 
         TextRenderer::RenderText("Press ESC to go back",
-            glm::vec2(camPos.x - 170.0f, camPos.y - 150.0f),
-            1.5f,
+            glm::vec2(camPos.x, camPos.y - 150.0f),
+            TextLayoutParams(1.5f, TextAlign::Center),
             glm::vec4(0.8f, 0.8f, 0.8f, 1.0f));
 
         if (m_ControlsMenu) m_ControlsMenu->Render(*GetCamera());
@@ -1315,8 +1236,8 @@ void GatorInvaders::OnRender()
         glm::vec2 camPos = GetCamera()->GetPosition();
 
         TextRenderer::RenderText("LEADERBOARD",
-            glm::vec2(camPos.x - 220.0f, camPos.y + 280.0f),
-            3.0f,
+            glm::vec2(camPos.x, camPos.y + 280.0f),
+            TextLayoutParams(3.0f, TextAlign::Center),
             glm::vec4(1, 1, 1, 1));
 
         float x = camPos.x - 260.0f;
@@ -1327,8 +1248,8 @@ void GatorInvaders::OnRender()
         if (m_Leaderboard.empty())
         {
             TextRenderer::RenderText("No scores yet!",
-                glm::vec2(camPos.x - 120.0f, camPos.y + 120.0f),
-                1.8f,
+                glm::vec2(camPos.x, camPos.y + 120.0f),
+                TextLayoutParams(1.8f, TextAlign::Center),
                 glm::vec4(0.9f, 0.9f, 0.9f, 1.0f));
         }
         else
@@ -1336,15 +1257,15 @@ void GatorInvaders::OnRender()
             for (int i = 0; i < (int)m_Leaderboard.size(); i++)
             {
                 const auto& e = m_Leaderboard[i];
-                std::string line = std::to_string(i + 1) + ".  " + e.initials + "    " + std::to_string(e.score);
-                TextRenderer::RenderText(line, glm::vec2(x, y), s, glm::vec4(1,1,1,1));
+                TextRenderer::RenderTextf(glm::vec2(x, y), s, glm::vec4(1,1,1,1),
+                    "%d.  %s    %d", i + 1, e.initials.c_str(), e.score);
                 y -= dy;
             }
         }
 
         TextRenderer::RenderText("Press ESC to go back",
-            glm::vec2(camPos.x - 170.0f, camPos.y - 170.0f),
-            1.5f,
+            glm::vec2(camPos.x, camPos.y - 170.0f),
+            TextLayoutParams(1.5f, TextAlign::Center),
             glm::vec4(0.8f, 0.8f, 0.8f, 1.0f));
 
         if (m_LeaderboardMenu) m_LeaderboardMenu->Render(*GetCamera());
@@ -1356,26 +1277,26 @@ void GatorInvaders::OnRender()
         glm::vec2 camPos = GetCamera()->GetPosition();
 
         TextRenderer::RenderText("NEW HIGH SCORE!",
-            glm::vec2(camPos.x - 260.0f, camPos.y + 180.0f),
-            2.8f,
+            glm::vec2(camPos.x, camPos.y + 180.0f),
+            TextLayoutParams(2.8f, TextAlign::Center),
             glm::vec4(1, 1, 0, 1));
 
         TextRenderer::RenderText("Enter your initials (3 letters):",
-            glm::vec2(camPos.x - 320.0f, camPos.y + 90.0f),
-            1.8f,
+            glm::vec2(camPos.x, camPos.y + 90.0f),
+            TextLayoutParams(1.8f, TextAlign::Center),
             glm::vec4(1, 1, 1, 1));
 
         std::string shown = m_InitialsInput;
         while (shown.size() < 3) shown += "_";
 
         TextRenderer::RenderText(shown,
-            glm::vec2(camPos.x - 50.0f, camPos.y + 20.0f),
-            3.0f,
+            glm::vec2(camPos.x, camPos.y + 20.0f),
+            TextLayoutParams(3.0f, TextAlign::Center),
             glm::vec4(1, 1, 1, 1));
 
         TextRenderer::RenderText("Press ENTER to submit",
-            glm::vec2(camPos.x - 190.0f, camPos.y - 80.0f),
-            1.6f,
+            glm::vec2(camPos.x, camPos.y - 80.0f),
+            TextLayoutParams(1.6f, TextAlign::Center),
             glm::vec4(0.8f, 0.8f, 0.8f, 1.0f));
 
         return;
@@ -1448,33 +1369,35 @@ void GatorInvaders::OnRender()
             e->Render();
 
     // Bullets + player
-    if (m_PlayerBullet) m_PlayerBullet->Render();
-    for (auto& b : m_EnemyBullets) if (b) b->Render();
+    ProjectileSystem::Render();
     if (m_Player) m_Player->Render();
 
+    if (Physics::IsDebugDrawEnabled())
+        DrawDebugOverlay();
+
     // ------------------------------------------------------------
     // UI (always during gameplay-ish states)
     // ------------------------------------------------------------
     glm::vec2 camPos = GetCamera()->GetPosition();
 
-    TextRenderer::RenderText("Score:" + std::to_string(m_Score),
+    TextRenderer::RenderNumber("Score:", m_Score,
         glm::vec2(camPos.x - 600.0f, camPos.y + 330.0f),
         2.0f,
         glm::vec4(1, 1, 1, 1));
 
-    TextRenderer::RenderText("FPS:" + std::to_string(Time::GetFPS()),
+    TextRenderer::RenderNumber("FPS:", Time::GetFPS(),
         glm::vec2(camPos.x - 600.0f, camPos.y + 290.0f),
         1.5f,
         glm::vec4(0.7f, 0.7f, 0.7f, 1.0f));
 
-    TextRenderer::RenderText("Lives:" + std::to_string(m_Lives),
-        glm::vec2(camPos.x + 440.0f, camPos.y + 330.0f),
-        2.0f,
+    TextRenderer::RenderNumber("Lives:", m_Lives,
+        glm::vec2(camPos.x + 600.0f, camPos.y + 330.0f),
+        TextLayoutParams(2.0f, TextAlign::Right),
         glm::vec4(0, 1, 0, 1));
 
-    TextRenderer::RenderText("Level:" + std::to_string(m_Level),
-        glm::vec2(camPos.x - 70.0f, camPos.y + 330.0f),
-        2.0f,
+    TextRenderer::RenderNumber("Level:", m_Level,
+        glm::vec2(camPos.x, camPos.y + 330.0f),
+        TextLayoutParams(2.0f, TextAlign::Center),
         glm::vec4(1, 1, 0, 1));
 
     // ------------------------------------------------------------
@@ -1482,24 +1405,19 @@ void GatorInvaders::OnRender()
     // ------------------------------------------------------------
     if (m_State == GameState::Paused)
     {
-        glm::vec2 pausedPos = glm::vec2(camPos.x - 100.0f, camPos.y + 200.0f);
-        float pausedScale = 3.0f;
-
-        glm::vec4 outlineColor(1, 1, 1, 1);
-        float o = 2.0f;
+        glm::vec2 pausedPos = glm::vec2(camPos.x, camPos.y + 200.0f);
+        TextLayoutParams pausedLayout(3.0f, TextAlign::Center);
 
-        // Outline
-        TextRenderer::RenderText("PAUSED", pausedPos + glm::vec2(-o,  0), pausedScale, outlineColor);
-        TextRenderer::RenderText("PAUSED", pausedPos + glm::vec2( o,  0), pausedScale, outlineColor);
-        TextRenderer::RenderText("PAUSED", pausedPos + glm::vec2( 0, -o), pausedScale, outlineColor);
-        TextRenderer::RenderText("PAUSED", pausedPos + glm::vec2( 0,  o), pausedScale, outlineColor);
+        TextEffects outline;
+        outline.OutlineWidth = 2.0f;
+        outline.OutlineColor = glm::vec4(1, 1, 1, 1);
 
-        // Main text
         TextRenderer::RenderText(
             "PAUSED",
             pausedPos,
-            pausedScale,
-            glm::vec4(1.0f, 1.0f, 0.0f, 1.0f) // bright yellow
+            pausedLayout,
+            glm::vec4(1.0f, 1.0f, 0.0f, 1.0f), // bright yellow
+            outline
         );
 
         if (m_PauseMenu) m_PauseMenu->Render(*GetCamera());
@@ -1509,30 +1427,74 @@ void GatorInvaders::OnRender()
     if (m_State == GameState::GameOver)
     {
         TextRenderer::RenderText("GAME OVER",
-            glm::vec2(camPos.x - 160.0f, camPos.y + 50.0f),
-            3.0f,
+            glm::vec2(camPos.x, camPos.y + 50.0f),
+            TextLayoutParams(3.0f, TextAlign::Center),
             glm::vec4(1, 0, 0, 1));
 
         TextRenderer::RenderText("Press ESC for Menu",
-            glm::vec2(camPos.x - 215.0f, camPos.y - 50.0f),
-            2.0f,
+            glm::vec2(camPos.x, camPos.y - 50.0f),
+            TextLayoutParams(2.0f, TextAlign::Center),
             glm::vec4(1, 1, 1, 1));
     }
     else if (m_State == GameState::LevelComplete)
     {
         TextRenderer::RenderText("LEVEL COMPLETE!",
-            glm::vec2(camPos.x - 235.0f, camPos.y + 50.0f),
-            3.0f,
+            glm::vec2(camPos.x, camPos.y + 50.0f),
+            TextLayoutParams(3.0f, TextAlign::Center),
             glm::vec4(0, 1, 0, 1));
 
         TextRenderer::RenderText("Press R for Next Level",
-            glm::vec2(camPos.x - 235.0f, camPos.y - 50.0f),
-            2.0f,
+            glm::vec2(camPos.x, camPos.y - 50.0f),
+            TextLayoutParams(2.0f, TextAlign::Center),
             glm::vec4(1, 1, 1, 1));
     }
 }
 
 
+
+// F1 view, on top of the collider shapes: what the formation AI is doing and frame timing
+void GatorInvaders::DrawDebugOverlay()
+{
+    const glm::vec4 aiColor(1.0f, 0.8f, 0.0f, 0.9f);
+
+    // Formation bounds, which way it marches, and the lines that turn it / end the game
+    AABB formation(glm::vec2(FLT_MAX), glm::vec2(-FLT_MAX));
+    for (auto& e : m_Enemies)
+    {
+        if (!e->IsAlive() || !e->GetCollider()) continue;
+        AABB bounds = e->GetCollider()->GetWorldBounds();
+        formation.Min = glm::min(formation.Min, bounds.Min);
+        formation.Max = glm::max(formation.Max, bounds.Max);
+    }
+
+    if (formation.Min.x <= formation.Max.x)
+    {
+        glm::vec2 center = formation.GetCenter();
+        DebugDraw::Rect(center, formation.GetSize(), aiColor, 2.0f);
+        DebugDraw::Line(center, center + glm::vec2((float)m_EnemyDirection * 60.0f, 0.0f), aiColor, 3.0f);
+        DebugDraw::Textf(glm::vec2(formation.Min.x, formation.Max.y + 20.0f), aiColor, 1.0f,
+                         "next step %.2fs / %.2fs", m_EnemyMoveInterval - m_EnemyMoveTimer, m_EnemyMoveInterval);
+
+        DebugDraw::Line(glm::vec2(-FORMATION_EDGE_X, formation.Min.y), glm::vec2(-FORMATION_EDGE_X, formation.Max.y), aiColor);
+        DebugDraw::Line(glm::vec2(FORMATION_EDGE_X, formation.Min.y), glm::vec2(FORMATION_EDGE_X, formation.Max.y), aiColor);
+    }
+    DebugDraw::Line(glm::vec2(-FORMATION_EDGE_X, INVASION_Y), glm::vec2(FORMATION_EDGE_X, INVASION_Y),
+                    glm::vec4(1.0f, 0.2f, 0.2f, 0.8f));
+
+    // UFO path to where it leaves the screen
+    if (m_UFOActive && m_UFO && m_UFO->IsAlive())
+    {
+        glm::vec2 ufo = m_UFO->GetPosition();
+        DebugDraw::Line(ufo, glm::vec2((float)m_UFODirection * 700.0f, ufo.y), aiColor);
+    }
+
+    // Frame timing
+    glm::vec2 camPos = GetCamera()->GetPosition();
+    DebugDraw::Textf(glm::vec2(camPos.x - 600.0f, camPos.y + 270.0f), glm::vec4(0.7f, 1.0f, 0.7f, 1.0f), 1.0f,
+                     "frame %.2f ms\nfixed step %.2f ms\ndebug vertices %zu",
+                     Time::DeltaTime() * 1000.0f, Time::FixedDeltaTime() * 1000.0f, DebugDraw::GetVertexCount());
+}
+
 void GatorInvaders::OnInput(float deltaTime)
 {
     // Global toggles
@@ -1683,8 +1645,7 @@ void GatorInvaders::NextLevel()
     m_Level++;
     m_State = GameState::Playing;
 
-    m_PlayerBullet.reset();
-    m_EnemyBullets.clear();
+    ProjectileSystem::Clear();
 
     if (m_Player)
         m_Player->SetPosition(m_PlayerStartPos);
@@ -1710,8 +1671,7 @@ void GatorInvaders::RestartGame()
     m_State = GameState::Playing;
     m_CurrentEnemyFrame = 0;
 
-    m_PlayerBullet.reset();
-    m_EnemyBullets.clear();
+    ProjectileSystem::Clear();
 
     if (!m_Player)
     {
@@ -1726,6 +1686,7 @@ void GatorInvaders::RestartGame()
 
         auto playerCollider = std::make_unique<BoxCollider>(m_Player.get(), m_Player->GetSize());
         playerCollider->SetTrigger(true);
+        SetLayers(playerCollider.get(), LAYER_PLAYER, PLAYER_MASK);
         m_Player->SetCollider(std::move(playerCollider));
     }
 